@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <jge/bit_plane.hpp>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace
+{
+jge::plane<bool> make_mask(const std::size_t side, const unsigned seed)
+{
+    jge::plane<bool> mask{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    std::mt19937 engine{seed};
+    std::bernoulli_distribution bit{0.5};
+    std::ranges::generate(to1d(mask), [&] { return bit(engine); });
+    return mask;
+}
+
+void and_dense(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    auto l{make_mask(side, 1)};
+    const auto r{make_mask(side, 2)};
+    for (auto _ : state)
+    {
+        std::ranges::transform(
+            to1d(l), to1d(r), to1d(l).begin(),
+            [](const bool a, const bool b) { return a && b; });
+        benchmark::DoNotOptimize(to1d(l).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void and_bits(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    jge::bit_plane l{make_mask(side, 1)};
+    const jge::bit_plane r{make_mask(side, 2)};
+    for (auto _ : state)
+    {
+        l &= r;
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void count_dense(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto mask{make_mask(side, 1)};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::ranges::count(to1d(mask), true));
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void count_bits(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::bit_plane mask{make_mask(side, 1)};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(mask.count());
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+// Counts the set elements of an unaligned subplane, like a view rectangle.
+void count_subplane_bits(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::bit_plane mask{make_mask(side, 1)};
+    const jge::bit_plane::subplane_type view{
+        jge::abscissa{std::size_t{13}} + jge::ordinate{std::size_t{7}},
+        jge::width{side - 30} + jge::height{side - 30}};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(mask.count(view));
+    state.SetItemsProcessed(state.iterations() * to1d(view.size));
+}
+
+void shift_dense(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto mask{make_mask(side, 1)};
+    auto out{mask};
+    for (auto _ : state)
+    {
+        // Moves every element by (3, 1), as `bit_plane::shifted` does.
+        for (std::size_t y{1}; y != side; ++y)
+        {
+            const auto from{to1d(mask).subspan((y - 1) * side, side - 3)};
+            std::ranges::copy(from, to1d(out).begin() + y * side + 3);
+        }
+        benchmark::DoNotOptimize(to1d(out).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void shift_bits(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::bit_plane mask{make_mask(side, 1)};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(mask.shifted(3, 1));
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(and_dense)->Arg(4096);
+BENCHMARK(and_bits)->Arg(4096);
+BENCHMARK(count_dense)->Arg(4096);
+BENCHMARK(count_bits)->Arg(4096);
+BENCHMARK(count_subplane_bits)->Arg(4096);
+BENCHMARK(shift_dense)->Arg(4096);
+BENCHMARK(shift_bits)->Arg(4096);
@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <jge/blit.hpp>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace
+{
+constexpr std::ptrdiff_t tile_side{32};
+constexpr std::ptrdiff_t tileset_tiles{16};
+
+using pixel = std::uint32_t;
+
+jge::plane<pixel> make_tileset()
+{
+    const std::size_t side{tile_side * tileset_tiles};
+    jge::plane<pixel> tileset{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(tileset).size(); ++i)
+        to1d(tileset)[i] = static_cast<pixel>(i * 2654435761u);
+    return tileset;
+}
+
+// The commands to compose a layer of `side` by `side` tiles, offset by half
+// a tile so that the tiles on its edges are clipped.
+std::vector<jge::blit_command> make_commands(const std::ptrdiff_t side)
+{
+    std::vector<jge::blit_command> commands;
+    for (std::ptrdiff_t y{0}; y != side + 1; ++y)
+        for (std::ptrdiff_t x{0}; x != side + 1; ++x)
+        {
+            const std::ptrdiff_t tile{(x * 7 + y * 13) % (tileset_tiles *
+                                                          tileset_tiles)};
+            commands.push_back(
+                {{jge::abscissa{tile % tileset_tiles * tile_side} +
+                      jge::ordinate{tile / tileset_tiles * tile_side},
+                  jge::width{tile_side} + jge::height{tile_side}},
+                 jge::abscissa{x * tile_side - tile_side / 2} +
+                     jge::ordinate{y * tile_side - tile_side / 2}});
+        }
+    return commands;
+}
+
+jge::plane<pixel> make_layer(const std::ptrdiff_t side)
+{
+    const auto pixels{static_cast<std::size_t>(side * tile_side)};
+    return jge::plane<pixel>{
+        jge::width{pixels} + jge::height{pixels}, jge::value_initialize};
+}
+
+// Composes the layer element by element, clipping each element.
+void compose_elements(benchmark::State& state)
+{
+    const auto tileset{make_tileset()};
+    const auto commands{make_commands(state.range(0))};
+    auto layer{make_layer(state.range(0))};
+    const auto w{static_cast<std::ptrdiff_t>(layer.size().w())};
+    const auto h{static_cast<std::ptrdiff_t>(layer.size().h())};
+    for (auto _ : state)
+    {
+        for (const jge::blit_command& c : commands)
+            for (std::ptrdiff_t y{0}; y != c.from.size.h(); ++y)
+                for (std::ptrdiff_t x{0}; x != c.from.size.w(); ++x)
+                {
+                    const std::ptrdiff_t tx{c.to.x() + x};
+                    const std::ptrdiff_t ty{c.to.y() + y};
+                    if (tx < 0 || ty < 0 || tx >= w || ty >= h)
+                        continue;
+                    layer[jge::abscissa{static_cast<std::size_t>(tx)} +
+                          jge::ordinate{static_cast<std::size_t>(ty)}] =
+                        tileset
+                            [jge::abscissa{static_cast<std::size_t>(
+                                 c.from.top_left.x() + x)} +
+                             jge::ordinate{static_cast<std::size_t>(
+                                 c.from.top_left.y() + y)}];
+                }
+        benchmark::DoNotOptimize(to1d(layer).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * to1d(layer).size_bytes());
+}
+
+void compose_blits(benchmark::State& state)
+{
+    const auto tileset{make_tileset()};
+    const auto commands{make_commands(state.range(0))};
+    auto layer{make_layer(state.range(0))};
+    for (auto _ : state)
+    {
+        for (const jge::blit_command& c : commands)
+            jge::blit(tileset, c.from, layer, c.to);
+        benchmark::DoNotOptimize(to1d(layer).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * to1d(layer).size_bytes());
+}
+
+void compose_batched(benchmark::State& state)
+{
+    const auto tileset{make_tileset()};
+    const auto commands{make_commands(state.range(0))};
+    auto layer{make_layer(state.range(0))};
+    for (auto _ : state)
+    {
+        jge::blit(tileset, commands, layer);
+        benchmark::DoNotOptimize(to1d(layer).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * to1d(layer).size_bytes());
+}
+
+void fill_elements(benchmark::State& state)
+{
+    auto layer{make_layer(state.range(0))};
+    const std::size_t side{layer.size().w()};
+    for (auto _ : state)
+    {
+        for (std::size_t y{1}; y != side - 1; ++y)
+            for (std::size_t x{1}; x != side - 1; ++x)
+                layer[jge::abscissa{x} + jge::ordinate{y}] = 0xFF00FF00;
+        benchmark::DoNotOptimize(to1d(layer).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * to1d(layer).size_bytes());
+}
+
+void fill_rows(benchmark::State& state)
+{
+    auto layer{make_layer(state.range(0))};
+    const auto side{static_cast<std::ptrdiff_t>(layer.size().w())};
+    const jge::subplane<std::ptrdiff_t> inner{
+        jge::abscissa{std::ptrdiff_t{1}} + jge::ordinate{std::ptrdiff_t{1}},
+        jge::width{side - 2} + jge::height{side - 2}};
+    for (auto _ : state)
+    {
+        jge::fill(layer, inner, pixel{0xFF00FF00});
+        benchmark::DoNotOptimize(to1d(layer).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * to1d(layer).size_bytes());
+}
+
+} // namespace
+
+BENCHMARK(compose_elements)->Arg(64);
+BENCHMARK(compose_blits)->Arg(64);
+BENCHMARK(compose_batched)->Arg(64);
+BENCHMARK(fill_elements)->Arg(64);
+BENCHMARK(fill_rows)->Arg(64);
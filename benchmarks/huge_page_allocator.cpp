@@ -0,0 +1,57 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/huge_page_allocator.hpp>
+#include <jge/plane.hpp>
+
+namespace
+{
+template <class Plane>
+void value_initialize(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state)
+    {
+        Plane p{jge::width{side} + jge::height{side}, jge::value_initialize};
+        benchmark::DoNotOptimize(to1d(p).data());
+    }
+    state.SetBytesProcessed(
+        state.iterations() * side * side *
+        sizeof(typename Plane::allocator_type::value_type));
+}
+
+template <class Plane>
+void random_access(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    Plane p{jge::width{side} + jge::height{side}, jge::value_initialize};
+    std::mt19937_64 engine{};
+    std::uniform_int_distribution<std::size_t> coordinate{0, side - 1};
+    std::vector<typename Plane::point_type> points(1 << 16);
+    for (auto& pt : points)
+        pt = {
+            jge::abscissa{coordinate(engine)},
+            jge::ordinate{coordinate(engine)}};
+    for (auto _ : state)
+        for (const auto pt : points)
+            benchmark::DoNotOptimize(++p[pt]);
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(value_initialize, jge::plane<std::uint32_t>)
+    ->Arg(4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(value_initialize, jge::huge_page_plane<std::uint32_t>)
+    ->Arg(4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(random_access, jge::plane<std::uint32_t>)
+    ->Arg(1024)
+    ->Arg(8192);
+BENCHMARK_TEMPLATE(random_access, jge::huge_page_plane<std::uint32_t>)
+    ->Arg(1024)
+    ->Arg(8192);
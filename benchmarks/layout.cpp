@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/layout.hpp>
+#include <jge/layout_plane.hpp>
+
+namespace
+{
+constexpr std::ptrdiff_t von_neumann[][2]{{0, -1}, {-1, 0}, {1, 0}, {0, 1}};
+constexpr std::ptrdiff_t moore[][2]{{-1, -1}, {0, -1}, {1, -1}, {-1, 0},
+                                    {1, 0},   {-1, 1}, {0, 1},  {1, 1}};
+
+template <class Layout>
+auto make_plane(const std::size_t side)
+{
+    jge::layout_plane<std::uint32_t, Layout> p{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    std::uint32_t i{0};
+    for (auto& e : p.storage())
+        e = i++;
+    return p;
+}
+
+template <class Plane>
+std::uint32_t neighborhood_sum(
+    const Plane& p, const std::size_t x, const std::size_t y,
+    const std::span<const std::ptrdiff_t[2]> neighbors)
+{
+    std::uint32_t sum{0};
+    for (const auto& d : neighbors)
+        sum += p[jge::abscissa{x + d[0]} + jge::ordinate{y + d[1]}];
+    return sum;
+}
+
+// Visits the interior points in row-major order.
+template <class Layout, const auto& Neighbors>
+void row_order(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto p{make_plane<Layout>(side)};
+    for (auto _ : state)
+    {
+        std::uint32_t sum{0};
+        for (std::size_t y{1}; y != side - 1; ++y)
+            for (std::size_t x{1}; x != side - 1; ++x)
+                sum += neighborhood_sum(p, x, y, Neighbors);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (side - 2) * (side - 2));
+}
+
+// Visits the interior points in storage order.
+template <class Layout, const auto& Neighbors>
+void storage_order(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto p{make_plane<Layout>(side)};
+    for (auto _ : state)
+    {
+        std::uint32_t sum{0};
+        for (std::size_t i{0}; i != p.storage().size(); ++i)
+        {
+            const auto pt{p.mapping().to2d(i)};
+            if (pt.x() - 1 < side - 2 && pt.y() - 1 < side - 2)
+                sum += neighborhood_sum(p, pt.x(), pt.y(), Neighbors);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (side - 2) * (side - 2));
+}
+
+} // namespace
+
+#define JGE_LAYOUT_BENCHMARK(order, layout, neighbors)                         \
+    BENCHMARK_TEMPLATE(order, layout, neighbors)->Arg(256)->Arg(4096)
+
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_row_major, von_neumann);
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_tiled<8>, von_neumann);
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_morton, von_neumann);
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_row_major, moore);
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_tiled<8>, moore);
+JGE_LAYOUT_BENCHMARK(row_order, jge::layout_morton, moore);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_row_major, von_neumann);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_tiled<8>, von_neumann);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_morton, von_neumann);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_row_major, moore);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_tiled<8>, moore);
+JGE_LAYOUT_BENCHMARK(storage_order, jge::layout_morton, moore);
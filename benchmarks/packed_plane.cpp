@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/packed_plane.hpp>
+#include <jge/plane.hpp>
+
+namespace
+{
+jge::plane<std::size_t> make_map(const std::size_t side, const std::size_t ids)
+{
+    jge::plane<std::size_t> map{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    std::mt19937 engine{};
+    std::uniform_int_distribution<std::size_t> id{0, ids - 1};
+    std::ranges::generate(to1d(map), [&] { return id(engine); });
+    return map;
+}
+
+// Counts the cells of one tile id over the whole map.
+void scan_dense(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto map{make_map(side, 16)};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::ranges::count(to1d(map), 3));
+    state.SetBytesProcessed(state.iterations() * to1d(map).size_bytes());
+    state.counters["storage_bytes"] = to1d(map).size_bytes();
+}
+
+template <std::size_t Bits>
+void scan_packed(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::packed_plane<Bits> map{
+        make_map(side, std::size_t{1} << std::min(Bits, std::size_t{4}))};
+    std::vector<std::uint8_t> row(side);
+    for (auto _ : state)
+    {
+        std::ptrdiff_t n{0};
+        for (std::size_t y{0}; y != side; ++y)
+        {
+            map.unpack_row_indices(y, row);
+            n += std::ranges::count(row, 3);
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() * map.storage_bytes());
+    state.counters["storage_bytes"] = map.storage_bytes();
+}
+
+template <std::size_t Bits>
+void unpack(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::packed_plane<Bits> map{make_map(side, 2)};
+    jge::plane<std::size_t> out{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (auto _ : state)
+    {
+        for (std::size_t y{0}; y != side; ++y)
+            map.unpack_row(y, to1d(out).subspan(y * side, side));
+        benchmark::DoNotOptimize(to1d(out).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+template <std::size_t Bits>
+void pack(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto dense{make_map(side, 2)};
+    jge::packed_plane<Bits> map{dense};
+    for (auto _ : state)
+    {
+        for (std::size_t y{0}; y != side; ++y)
+            map.pack_row(y, to1d(dense).subspan(y * side, side));
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(scan_dense)->Arg(4096);
+BENCHMARK_TEMPLATE(scan_packed, 4)->Arg(4096);
+BENCHMARK_TEMPLATE(scan_packed, 8)->Arg(4096);
+BENCHMARK_TEMPLATE(unpack, 1)->Arg(4096);
+BENCHMARK_TEMPLATE(unpack, 4)->Arg(4096);
+BENCHMARK_TEMPLATE(unpack, 8)->Arg(4096);
+BENCHMARK_TEMPLATE(pack, 1)->Arg(4096);
+BENCHMARK_TEMPLATE(pack, 4)->Arg(4096);
+BENCHMARK_TEMPLATE(pack, 8)->Arg(4096);
@@ -0,0 +1,121 @@
+#include <cstddef>
+#include <functional>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/par.hpp>
+#include <jge/plane.hpp>
+#include <jge/thread_pool.hpp>
+
+namespace
+{
+constexpr std::size_t side{4096};
+
+jge::plane<float> make_plane()
+{
+    jge::plane<float> p{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(p).size(); ++i)
+        to1d(p)[i] = static_cast<float>(i % 1'000) / 1'000;
+    return p;
+}
+
+// A few operations per element, like a shading pass.
+constexpr auto shade = [](const jge::point2d<std::size_t> pt, const float e)
+{
+    const float x{static_cast<float>(pt.x()) / side};
+    const float y{static_cast<float>(pt.y()) / side};
+    return e * 0.75f + x * y * 0.25f;
+};
+
+constexpr auto is_bright = [](jge::point2d<std::size_t>, const float e)
+{
+    return e > 0.5f;
+};
+
+void transform_serial(benchmark::State& state)
+{
+    const auto from{make_plane()};
+    auto to{make_plane()};
+    for (auto _ : state)
+    {
+        for (std::size_t y{0}; y != side; ++y)
+            for (std::size_t x{0}; x != side; ++x)
+            {
+                const auto pt{jge::abscissa{x} + jge::ordinate{y}};
+                to[pt] = shade(pt, from[pt]);
+            }
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void transform_par(benchmark::State& state)
+{
+    jge::thread_pool pool{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_plane()};
+    auto to{make_plane()};
+    for (auto _ : state)
+    {
+        jge::par::transform(from, to, shade, pool);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void reduce_serial(benchmark::State& state)
+{
+    const auto p{make_plane()};
+    for (auto _ : state)
+    {
+        double sum{0};
+        for (const float e : to1d(p))
+            sum += e;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void reduce_par(benchmark::State& state)
+{
+    jge::thread_pool pool{static_cast<std::size_t>(state.range(0))};
+    const auto p{make_plane()};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            jge::par::reduce(p, 0.0, std::plus<>{}, pool));
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void count_if_serial(benchmark::State& state)
+{
+    const auto p{make_plane()};
+    for (auto _ : state)
+    {
+        std::size_t count{0};
+        for (std::size_t y{0}; y != side; ++y)
+            for (std::size_t x{0}; x != side; ++x)
+            {
+                const auto pt{jge::abscissa{x} + jge::ordinate{y}};
+                count += is_bright(pt, p[pt]);
+            }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void count_if_par(benchmark::State& state)
+{
+    jge::thread_pool pool{static_cast<std::size_t>(state.range(0))};
+    const auto p{make_plane()};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(jge::par::count_if(p, is_bright, pool));
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(transform_serial)->UseRealTime();
+BENCHMARK(transform_par)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(reduce_serial)->UseRealTime();
+BENCHMARK(reduce_par)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(count_if_serial)->UseRealTime();
+BENCHMARK(count_if_par)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
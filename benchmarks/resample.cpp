@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/mip_pyramid.hpp>
+#include <jge/plane.hpp>
+#include <jge/resample.hpp>
+
+namespace
+{
+using rgba = std::array<std::uint8_t, 4>;
+
+jge::size2d<std::size_t> square(const std::size_t side)
+{
+    return jge::width{side} + jge::height{side};
+}
+
+jge::plane<rgba> make_layer(const std::size_t side)
+{
+    jge::plane<rgba> p{square(side), jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(p).size(); ++i)
+    {
+        const auto v{static_cast<std::uint32_t>(i * 2654435761u)};
+        to1d(p)[i] = rgba{
+            std::uint8_t(v), std::uint8_t(v >> 8), std::uint8_t(v >> 16), 255};
+    }
+    return p;
+}
+
+// Bilinear magnification, computing the weights of each element as it
+// goes, as a hand-written loop would.
+void bilinear_hand_written(benchmark::State& state)
+{
+    const auto from{make_layer(1024)};
+    jge::plane<rgba> to{square(1536), jge::value_initialize};
+    const double scale{1024.0 / 1536.0};
+    for (auto _ : state)
+    {
+        for (std::size_t y{0}; y != 1536; ++y)
+            for (std::size_t x{0}; x != 1536; ++x)
+            {
+                const double u{std::clamp(
+                    (double(x) + 0.5) * scale - 0.5, 0.0, 1023.0)};
+                const double v{std::clamp(
+                    (double(y) + 0.5) * scale - 0.5, 0.0, 1023.0)};
+                const auto x0{std::size_t(u)};
+                const auto y0{std::size_t(v)};
+                const std::size_t x1{std::min(x0 + 1, std::size_t{1023})};
+                const std::size_t y1{std::min(y0 + 1, std::size_t{1023})};
+                const double fx{u - double(x0)};
+                const double fy{v - double(y0)};
+                for (std::size_t c{0}; c != 4; ++c)
+                {
+                    const auto e{[&](const std::size_t i, const std::size_t j) {
+                        return double(
+                            from[jge::abscissa{i} + jge::ordinate{j}][c]);
+                    }};
+                    to[jge::abscissa{x} + jge::ordinate{y}][c] =
+                        static_cast<std::uint8_t>(std::lround(
+                            (e(x0, y0) * (1 - fx) + e(x1, y0) * fx) *
+                                (1 - fy) +
+                            (e(x0, y1) * (1 - fx) + e(x1, y1) * fx) * fy));
+                }
+            }
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1536 * 1536);
+}
+
+void bilinear_resample(benchmark::State& state)
+{
+    const auto from{make_layer(1024)};
+    jge::plane<rgba> to{square(1536), jge::value_initialize};
+    for (auto _ : state)
+    {
+        jge::resample(from, to, jge::resample_filter::bilinear);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1536 * 1536);
+}
+
+// A 512x512 minimap of a 4096x4096 layer.
+void box_minimap(benchmark::State& state)
+{
+    const auto from{make_layer(4096)};
+    jge::plane<rgba> to{square(512), jge::value_initialize};
+    for (auto _ : state)
+    {
+        jge::resample(from, to, jge::resample_filter::box);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * 4096 * 4096);
+}
+
+// Builds every level by resampling the base, as a hand-written loop
+// would, for comparison with halving each level.
+void pyramid_resampled(benchmark::State& state)
+{
+    const auto base{make_layer(4096)};
+    for (auto _ : state)
+        for (std::size_t side{2048}; side != 0; side /= 2)
+            benchmark::DoNotOptimize(jge::resample(
+                base, square(side), jge::resample_filter::box));
+    state.SetItemsProcessed(state.iterations() * 4096 * 4096);
+}
+
+void pyramid(benchmark::State& state)
+{
+    const auto base{make_layer(4096)};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto copy{base};
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(jge::mip_pyramid<rgba>{std::move(copy)});
+    }
+    state.SetItemsProcessed(state.iterations() * 4096 * 4096);
+}
+
+void pyramid_gray(benchmark::State& state)
+{
+    jge::plane<std::uint8_t> base{square(4096), jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(base).size(); ++i)
+        to1d(base)[i] = static_cast<std::uint8_t>(i * 2654435761u >> 24);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto copy{base};
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(
+            jge::mip_pyramid<std::uint8_t>{std::move(copy)});
+    }
+    state.SetItemsProcessed(state.iterations() * 4096 * 4096);
+}
+
+} // namespace
+
+BENCHMARK(bilinear_hand_written)->UseRealTime();
+BENCHMARK(bilinear_resample)->UseRealTime();
+BENCHMARK(box_minimap)->UseRealTime();
+BENCHMARK(pyramid_resampled)->UseRealTime();
+BENCHMARK(pyramid)->UseRealTime();
+BENCHMARK(pyramid_gray)->UseRealTime();
@@ -0,0 +1,91 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/rle_plane.hpp>
+
+namespace
+{
+using tile_id = std::uint16_t;
+
+enum : tile_id
+{
+    sky,
+    grass,
+    dirt,
+    stone,
+    tree
+};
+
+// A side-view tile layer: sky above rolling hills of grass, dirt and stone,
+// with scattered trees.
+jge::plane<tile_id> make_map(const std::size_t side)
+{
+    jge::plane<tile_id> map{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    std::mt19937 engine{};
+    std::bernoulli_distribution has_tree{0.02};
+    for (std::size_t x{0}; x != side; ++x)
+    {
+        const auto surface{static_cast<std::size_t>(
+            side * (0.4 + 0.05 * std::sin(x / 40.0) +
+                    0.02 * std::sin(x / 7.0)))};
+        for (std::size_t y{surface}; y != side; ++y)
+        {
+            const std::size_t depth{y - surface};
+            map[jge::abscissa{x} + jge::ordinate{y}] =
+                depth == 0 ? grass : depth < 12 ? dirt : stone;
+        }
+        if (has_tree(engine))
+            map[jge::abscissa{x} + jge::ordinate{surface - 1}] = tree;
+    }
+    return map;
+}
+
+template <class Plane>
+void random_access(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const Plane map{make_map(side)};
+    std::mt19937_64 engine{};
+    std::uniform_int_distribution<std::size_t> coordinate{0, side - 1};
+    std::vector<typename Plane::point_type> points(1 << 16);
+    for (auto& pt : points)
+        pt = {
+            jge::abscissa{coordinate(engine)},
+            jge::ordinate{coordinate(engine)}};
+    for (auto _ : state)
+        for (const auto pt : points)
+            benchmark::DoNotOptimize(map[pt]);
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+void memory_usage(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::plane<tile_id> map{make_map(side)};
+    std::size_t runs{0};
+    for (auto _ : state)
+    {
+        const jge::rle_plane<tile_id> rle{map};
+        runs = rle.run_count();
+        benchmark::DoNotOptimize(runs);
+    }
+    const double dense_bytes(to1d(map).size_bytes());
+    const double rle_bytes(
+        runs * sizeof(jge::rle_plane<tile_id>::run_type) +
+        (side + 1) * sizeof(std::size_t));
+    state.counters["dense_bytes"] = dense_bytes;
+    state.counters["rle_bytes"]   = rle_bytes;
+    state.counters["ratio"]       = dense_bytes / rle_bytes;
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(random_access, jge::plane<tile_id>)->Arg(2048);
+BENCHMARK_TEMPLATE(random_access, jge::rle_plane<tile_id>)->Arg(2048);
+BENCHMARK(memory_usage)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,49 @@
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/views/points.hpp>
+#include <jge/views/rows.hpp>
+
+namespace
+{
+jge::plane<std::uint8_t> make_image(const std::size_t side)
+{
+    return jge::plane<std::uint8_t>{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+}
+
+// Halves the brightness of every pixel, the way examples/lpc walks planes.
+void points_index(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    auto image{make_image(side)};
+    for (auto _ : state)
+    {
+        for (const auto pt : jge::views::points(image.size()))
+            image[pt] = static_cast<std::uint8_t>(image[pt] / 2 + 1);
+        benchmark::DoNotOptimize(to1d(image).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void rows(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    auto image{make_image(side)};
+    for (auto _ : state)
+    {
+        for (const std::span<std::uint8_t> row : jge::views::rows(image))
+            for (std::uint8_t& e : row)
+                e = static_cast<std::uint8_t>(e / 2 + 1);
+        benchmark::DoNotOptimize(to1d(image).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(points_index)->Arg(1024);
+BENCHMARK(rows)->Arg(1024);
@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/small_plane.hpp>
+
+namespace
+{
+std::size_t allocations{0};
+
+template <class T>
+struct counting_allocator : std::allocator<T>
+{
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(const std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+
+    template <class U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+};
+
+template <class Plane>
+void construct_and_destroy(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::size2d sz{jge::width{side}, jge::height{side}};
+    allocations = 0;
+    for (auto _ : state)
+    {
+        Plane p{sz, jge::value_initialize};
+        benchmark::DoNotOptimize(to1d(p).data());
+    }
+    state.counters["allocations"] = static_cast<double>(allocations);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(
+    construct_and_destroy, jge::plane<int, counting_allocator<int>>)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(4);
+BENCHMARK_TEMPLATE(
+    construct_and_destroy, jge::small_plane<int, 16, counting_allocator<int>>)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(4);
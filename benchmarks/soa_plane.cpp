@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/soa_plane.hpp>
+
+namespace
+{
+struct cell
+{
+    std::uint32_t terrain;
+    float height;
+    float light;
+    std::uint32_t flags;
+};
+
+void light_pass_aos(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::plane<cell> p{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (auto _ : state)
+    {
+        float sum{0};
+        for (const cell& c : to1d(p))
+            sum += c.light;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void light_pass_soa(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const jge::soa_plane<std::uint32_t, float, float, std::uint32_t> p{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (auto _ : state)
+    {
+        float sum{0};
+        for (const float light : to1d<2>(p))
+            sum += light;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(light_pass_aos)->Arg(256)->Arg(4096);
+BENCHMARK(light_pass_soa)->Arg(256)->Arg(4096);
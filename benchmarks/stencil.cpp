@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/stencil.hpp>
+
+namespace
+{
+constexpr std::size_t side{2048};
+
+template <class T>
+jge::plane<T> make_plane()
+{
+    jge::plane<T> p{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(p).size(); ++i)
+        to1d(p)[i] = static_cast<T>(i * 2654435761u % 7 == 0);
+    return p;
+}
+
+constexpr std::array<float, 5> gaussian{
+    1.f / 16, 4.f / 16, 6.f / 16, 4.f / 16, 1.f / 16};
+
+jge::plane<float> gaussian_kernel()
+{
+    jge::plane<float> k{
+        jge::width{std::size_t{5}} + jge::height{std::size_t{5}},
+        jge::value_initialize};
+    for (std::size_t y{0}; y != 5; ++y)
+        for (std::size_t x{0}; x != 5; ++x)
+            k[jge::abscissa{x} + jge::ordinate{y}] = gaussian[x] * gaussian[y];
+    return k;
+}
+
+// The hand-written stencil: checks each neighbor against the plane, and
+// clamps those outside it.
+void gaussian_hand_written(benchmark::State& state)
+{
+    const auto from{make_plane<float>()};
+    auto to{make_plane<float>()};
+    const auto kernel{gaussian_kernel()};
+    const jge::size2d<std::ptrdiff_t> sz = from.size();
+    for (auto _ : state)
+    {
+        for (std::ptrdiff_t y{0}; y != sz.h(); ++y)
+            for (std::ptrdiff_t x{0}; x != sz.w(); ++x)
+            {
+                float sum{0};
+                for (std::ptrdiff_t dy{-2}; dy <= 2; ++dy)
+                    for (std::ptrdiff_t dx{-2}; dx <= 2; ++dx)
+                    {
+                        jge::point2d<std::ptrdiff_t> pt{
+                            jge::abscissa{x + dx} + jge::ordinate{y + dy}};
+                        if (!contains(sz, pt))
+                            pt = jge::abscissa{std::clamp(
+                                     pt.x(), std::ptrdiff_t{0}, sz.w() - 1)} +
+                                 jge::ordinate{std::clamp(
+                                     pt.y(), std::ptrdiff_t{0}, sz.h() - 1)};
+                        sum += kernel
+                                   [jge::abscissa{std::size_t(dx + 2)} +
+                                    jge::ordinate{std::size_t(dy + 2)}] *
+                               from[jge::point2d<std::size_t>(pt)];
+                    }
+                to[jge::abscissa{std::size_t(x)} +
+                   jge::ordinate{std::size_t(y)}] = sum;
+            }
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void gaussian_convolve(benchmark::State& state)
+{
+    const auto from{make_plane<float>()};
+    auto to{make_plane<float>()};
+    const auto kernel{gaussian_kernel()};
+    for (auto _ : state)
+    {
+        jge::convolve(from, to, kernel);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void gaussian_separable(benchmark::State& state)
+{
+    const auto from{make_plane<float>()};
+    auto to{make_plane<float>()};
+    for (auto _ : state)
+    {
+        jge::convolve_separable(from, to, gaussian, gaussian);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+// Counts the live neighbors of each cell of a wrapping Game of Life.
+void neighbors_hand_written(benchmark::State& state)
+{
+    const auto from{make_plane<std::uint8_t>()};
+    auto to{make_plane<std::uint8_t>()};
+    const jge::size2d<std::ptrdiff_t> sz = from.size();
+    for (auto _ : state)
+    {
+        for (std::ptrdiff_t y{0}; y != sz.h(); ++y)
+            for (std::ptrdiff_t x{0}; x != sz.w(); ++x)
+            {
+                int count{0};
+                for (std::ptrdiff_t dy{-1}; dy <= 1; ++dy)
+                    for (std::ptrdiff_t dx{-1}; dx <= 1; ++dx)
+                    {
+                        if (dx == 0 && dy == 0)
+                            continue;
+                        jge::point2d<std::ptrdiff_t> pt{
+                            jge::abscissa{x + dx} + jge::ordinate{y + dy}};
+                        if (!contains(sz, pt))
+                            pt = jge::abscissa{(pt.x() + sz.w()) % sz.w()} +
+                                 jge::ordinate{(pt.y() + sz.h()) % sz.h()};
+                        count += from[jge::point2d<std::size_t>(pt)];
+                    }
+                to[jge::abscissa{std::size_t(x)} +
+                   jge::ordinate{std::size_t(y)}] =
+                    static_cast<std::uint8_t>(count);
+            }
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+void neighbors_stencil(benchmark::State& state)
+{
+    const auto from{make_plane<std::uint8_t>()};
+    auto to{make_plane<std::uint8_t>()};
+    for (auto _ : state)
+    {
+        jge::stencil(
+            from, to, 1,
+            [](const auto& n) {
+                return n(-1, -1) + n(0, -1) + n(1, -1) + n(-1, 0) + n(1, 0) +
+                       n(-1, 1) + n(0, 1) + n(1, 1);
+            },
+            jge::border::wrap{});
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+} // namespace
+
+BENCHMARK(gaussian_hand_written)->UseRealTime();
+BENCHMARK(gaussian_convolve)->UseRealTime();
+BENCHMARK(gaussian_separable)->UseRealTime();
+BENCHMARK(neighbors_hand_written)->UseRealTime();
+BENCHMARK(neighbors_stencil)->UseRealTime();
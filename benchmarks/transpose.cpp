@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/transpose.hpp>
+
+namespace
+{
+using pixel = std::uint32_t;
+
+jge::plane<pixel> make_image(const std::size_t side)
+{
+    return jge::plane<pixel>{
+        jge::width{side} + jge::height{side}, jge::value_initialize};
+}
+
+void set_bytes(benchmark::State& state, const std::size_t side)
+{
+    // Each element is read once and written once.
+    state.SetBytesProcessed(
+        state.iterations() * 2 * side * side * sizeof(pixel));
+}
+
+// The memory bandwidth bound.
+void copy(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_image(side)};
+    auto to{make_image(side)};
+    for (auto _ : state)
+    {
+        std::ranges::copy(to1d(from), to1d(to).begin());
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    set_bytes(state, side);
+}
+
+// The loop over operator[] that the kernels replace.
+void rotate90_naive(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_image(side)};
+    auto to{make_image(side)};
+    for (auto _ : state)
+    {
+        for (std::size_t y{0}; y != side; ++y)
+            for (std::size_t x{0}; x != side; ++x)
+                to[jge::abscissa{side - 1 - y} + jge::ordinate{x}] =
+                    from[jge::abscissa{x} + jge::ordinate{y}];
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    set_bytes(state, side);
+}
+
+void rotate90(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_image(side)};
+    auto to{make_image(side)};
+    for (auto _ : state)
+    {
+        jge::rotate90(from, to);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    set_bytes(state, side);
+}
+
+void transpose(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_image(side)};
+    auto to{make_image(side)};
+    for (auto _ : state)
+    {
+        jge::transpose(from, to);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    set_bytes(state, side);
+}
+
+void transpose_in_place(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    auto image{make_image(side)};
+    for (auto _ : state)
+    {
+        jge::transpose(image);
+        benchmark::DoNotOptimize(to1d(image).data());
+    }
+    set_bytes(state, side);
+}
+
+void flip_x(benchmark::State& state)
+{
+    const auto side{static_cast<std::size_t>(state.range(0))};
+    const auto from{make_image(side)};
+    auto to{make_image(side)};
+    for (auto _ : state)
+    {
+        jge::flip_x(from, to);
+        benchmark::DoNotOptimize(to1d(to).data());
+    }
+    set_bytes(state, side);
+}
+
+} // namespace
+
+BENCHMARK(copy)->Arg(4096);
+BENCHMARK(rotate90_naive)->Arg(4096);
+BENCHMARK(rotate90)->Arg(4096);
+BENCHMARK(transpose)->Arg(4096);
+BENCHMARK(transpose_in_place)->Arg(4096);
+BENCHMARK(flip_x)->Arg(4096);
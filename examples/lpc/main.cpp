@@ -6,6 +6,7 @@
 #include <jge/cartesian.hpp>
 #include <jge/pixels.hpp>
 #include <jge/plane.hpp>
+#include <jge/static_plane.hpp>
 #include <jge/views/points.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
@@ -202,7 +203,7 @@ int main()
     sf::RenderWindow window(sf::VideoMode(800, 600), "SFML window");
     // Load a sprite to display
     tile_set tset{image::load_from_file("grass.png").value()};
-    const jge::plane background{
+    constexpr jge::static_plane<std::size_t, 6, 3> background{
         {15, 16, 17, 10, 17, 16},
         {16, 17, 10, 10, 10, 17},
         {17, 10, 10, 17, 10, 10}};
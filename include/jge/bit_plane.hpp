@@ -0,0 +1,436 @@
+#ifndef JGE_BIT_PLANE_HPP
+#define JGE_BIT_PLANE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// A plane of `bool` that stores one bit per element, in rows of whole 64-bit
+// words. The bits past the width of a row are always zero, so whole-plane
+// operations work on whole words, in loops that compilers vectorize.
+class [[nodiscard]] bit_plane
+{
+public:
+    using value_type    = bool;
+    using word_type     = std::uint64_t;
+    using width_type    = width<std::size_t>;
+    using size_type     = size2d<width_type::rep>;
+    using point_type    = point2d<size_type::rep>;
+    using subplane_type = subplane<size_type::rep>;
+
+    static constexpr std::size_t word_bits{64};
+
+private:
+    size_type sz{};
+    std::size_t row_words{};
+    std::vector<word_type> words;
+
+    static constexpr std::size_t words_for(const width_type w) noexcept
+    {
+        return (w() + word_bits - 1) / word_bits;
+    }
+
+    // The `n` lowest bits.
+    static constexpr word_type low_bits(const std::size_t n) noexcept
+    {
+        return n >= word_bits ? ~word_type{0} : (word_type{1} << n) - 1;
+    }
+
+    // The bits of word `k` of a row that are in [x0, x1).
+    static constexpr word_type range_bits(
+        const std::size_t k, const std::size_t x0,
+        const std::size_t x1) noexcept
+    {
+        const std::size_t first{k * word_bits};
+        return low_bits(x1 - first) &
+               ~low_bits(x0 > first ? x0 - first : std::size_t{0});
+    }
+
+    // The 64 bits of `row` starting at bit `bit`, with zeros outside `row`.
+    static word_type
+    load_bits(const std::span<const word_type> row, const std::ptrdiff_t bit)
+    {
+        const auto n{static_cast<std::ptrdiff_t>(row.size() * word_bits)};
+        if (bit <= -std::ptrdiff_t{word_bits} || bit >= n)
+            return 0;
+        if (bit < 0)
+            return row[0] << -bit;
+        const auto k{static_cast<std::size_t>(bit) / word_bits};
+        const auto offset{static_cast<std::size_t>(bit) % word_bits};
+        if (offset == 0)
+            return row[k];
+        const word_type high{k + 1 != row.size() ? row[k + 1] : 0};
+        return row[k] >> offset | high << (word_bits - offset);
+    }
+
+    std::size_t word_index(const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return pt.y() * row_words + pt.x() / word_bits;
+    }
+
+    static word_type bit_of(const point_type pt) noexcept
+    {
+        return word_type{1} << pt.x() % word_bits;
+    }
+
+    void clear_padding() noexcept
+    {
+        if (sz.w() % word_bits == 0)
+            return;
+        const word_type kept{low_bits(sz.w() % word_bits)};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            words[y * row_words + row_words - 1] &= kept;
+    }
+
+    // Calls `f(i, mask, y, k)` for each word `k` of each row `y` that
+    // intersects `s`, in row-major order, where `i` is the index of the word
+    // in `words` and `mask` selects its bits in `s`.
+    // Stops, and returns `true`, as soon as `f` returns `true`.
+    template <class F>
+    bool for_each_word(const subplane_type& s, F f) const
+    {
+        assert(contains(sz, s));
+        if (s.size.w() == 0)
+            return false;
+        const std::size_t x0{s.top_left.x()};
+        const std::size_t x1{s.bottom_right().x()};
+        for (std::size_t y{s.top_left.y()}; y != s.bottom_right().y(); ++y)
+            for (std::size_t k{x0 / word_bits}; k <= (x1 - 1) / word_bits; ++k)
+                if (f(y * row_words + k, range_bits(k, x0, x1), y, k))
+                    return true;
+        return false;
+    }
+
+    subplane_type whole() const noexcept
+    {
+        return {{}, sz};
+    }
+
+public:
+    // A proxy for an element.
+    class reference
+    {
+        bit_plane* p;
+        point_type pt;
+
+        friend bit_plane;
+
+        constexpr reference(bit_plane& p, const point_type pt) noexcept
+          : p{&p}, pt{pt}
+        {
+        }
+
+    public:
+        reference(const reference&) = default;
+
+        operator bool() const noexcept
+        {
+            return p->test(pt);
+        }
+
+        const reference& operator=(const bool v) const noexcept
+        {
+            p->set(pt, v);
+            return *this;
+        }
+
+        const reference& operator=(const reference& r) const noexcept
+        {
+            return *this = static_cast<bool>(r);
+        }
+    };
+
+    bit_plane() = default;
+
+    explicit bit_plane(const size_type sz, const bool value = false)
+      : sz{sz},
+        row_words{words_for(sz.w)},
+        words(row_words * sz.h(), value ? ~word_type{0} : word_type{0})
+    {
+        clear_padding();
+    }
+
+    template <class Allocator>
+    explicit bit_plane(const plane<bool, Allocator>& p) : bit_plane{p.size()}
+    {
+        const std::span<const bool> elements{to1d(p)};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+                words[y * row_words + x / word_bits] |=
+                    word_type{elements[y * sz.w() + x]} << x % word_bits;
+    }
+
+    bit_plane(const std::initializer_list<std::initializer_list<bool>> il2d)
+      : bit_plane{plane<bool>{il2d}}
+    {
+    }
+
+    template <class Allocator>
+    explicit operator plane<bool, Allocator>() const
+    {
+        plane<bool, Allocator> p{sz, default_initialize};
+        const std::span<bool> elements{to1d(p)};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+                elements[y * sz.w() + x] =
+                    (words[y * row_words + x / word_bits] >> x % word_bits &
+                     1) != 0;
+        return p;
+    }
+
+    // Element access.
+
+    [[nodiscard]] reference operator[](const point_type pt) noexcept
+    {
+        return {*this, pt};
+    }
+
+    [[nodiscard]] bool operator[](const point_type pt) const noexcept
+    {
+        return test(pt);
+    }
+
+    [[nodiscard]] bool test(const point_type pt) const noexcept
+    {
+        return (words[word_index(pt)] & bit_of(pt)) != 0;
+    }
+
+    void set(const point_type pt, const bool value = true) noexcept
+    {
+        word_type& w{words[word_index(pt)]};
+        w = value ? w | bit_of(pt) : w & ~bit_of(pt);
+    }
+
+    void reset(const point_type pt) noexcept
+    {
+        set(pt, false);
+    }
+
+    void flip(const point_type pt) noexcept
+    {
+        words[word_index(pt)] ^= bit_of(pt);
+    }
+
+    // Subplane operations.
+
+    void set(const subplane_type& s, const bool value = true) noexcept
+    {
+        for_each_word(s, [&](const std::size_t i, const word_type mask,
+                             std::size_t, std::size_t) {
+            words[i] = value ? words[i] | mask : words[i] & ~mask;
+            return false;
+        });
+    }
+
+    void reset(const subplane_type& s) noexcept
+    {
+        set(s, false);
+    }
+
+    void flip(const subplane_type& s) noexcept
+    {
+        for_each_word(s, [&](const std::size_t i, const word_type mask,
+                             std::size_t, std::size_t) {
+            words[i] ^= mask;
+            return false;
+        });
+    }
+
+    // Assigns `op(e, o)` to each element `e` of the subplane of `*this` at
+    // `at` with the size of `other`, where `o` is the corresponding element
+    // of `other`. `op` is applied to whole words, so it must be bitwise, like
+    // `std::bit_and<>`.
+    template <class Op>
+    void assign_at(const point_type at, const bit_plane& other, Op op)
+    {
+        for_each_word(
+            {at, other.sz}, [&](const std::size_t i, const word_type mask,
+                                const std::size_t y, const std::size_t k) {
+                const word_type o{load_bits(
+                    other.row(y - at.y()),
+                    static_cast<std::ptrdiff_t>(k * word_bits) -
+                        static_cast<std::ptrdiff_t>(at.x()))};
+                words[i] = (words[i] & ~mask) |
+                           (static_cast<word_type>(op(words[i], o)) & mask);
+                return false;
+            });
+    }
+
+    [[nodiscard]] std::size_t count(const subplane_type& s) const noexcept
+    {
+        std::size_t n{0};
+        for_each_word(s, [&](const std::size_t i, const word_type mask,
+                             std::size_t, std::size_t) {
+            n += static_cast<std::size_t>(std::popcount(words[i] & mask));
+            return false;
+        });
+        return n;
+    }
+
+    // The first set element of `s` in row-major order, if any.
+    [[nodiscard]] std::optional<point_type>
+    find_first(const subplane_type& s) const noexcept
+    {
+        std::optional<point_type> found;
+        for_each_word(s, [&](const std::size_t i, const word_type mask,
+                             const std::size_t y, const std::size_t k) {
+            if (const word_type w{words[i] & mask}; w != 0)
+            {
+                const auto x{static_cast<std::size_t>(std::countr_zero(w))};
+                found = abscissa{k * word_bits + x} + ordinate{y};
+                return true;
+            }
+            return false;
+        });
+        return found;
+    }
+
+    // Whole-plane operations.
+
+    void set() noexcept
+    {
+        std::ranges::fill(words, ~word_type{0});
+        clear_padding();
+    }
+
+    void reset() noexcept
+    {
+        std::ranges::fill(words, word_type{0});
+    }
+
+    void flip() noexcept
+    {
+        for (word_type& w : words)
+            w = ~w;
+        clear_padding();
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept
+    {
+        std::size_t n{0};
+        for (const word_type w : words)
+            n += static_cast<std::size_t>(std::popcount(w));
+        return n;
+    }
+
+    [[nodiscard]] bool any() const noexcept
+    {
+        return std::ranges::any_of(words, [](const word_type w) {
+            return w != 0;
+        });
+    }
+
+    [[nodiscard]] bool none() const noexcept
+    {
+        return !any();
+    }
+
+    [[nodiscard]] std::optional<point_type> find_first() const noexcept
+    {
+        return find_first(whole());
+    }
+
+    bit_plane& operator&=(const bit_plane& other) noexcept
+    {
+        assert(sz == other.sz);
+        for (std::size_t i{0}; i != words.size(); ++i)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    bit_plane& operator|=(const bit_plane& other) noexcept
+    {
+        assert(sz == other.sz);
+        for (std::size_t i{0}; i != words.size(); ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    bit_plane& operator^=(const bit_plane& other) noexcept
+    {
+        assert(sz == other.sz);
+        for (std::size_t i{0}; i != words.size(); ++i)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    [[nodiscard]] friend bit_plane operator&(bit_plane l, const bit_plane& r)
+    {
+        return l &= r;
+    }
+
+    [[nodiscard]] friend bit_plane operator|(bit_plane l, const bit_plane& r)
+    {
+        return l |= r;
+    }
+
+    [[nodiscard]] friend bit_plane operator^(bit_plane l, const bit_plane& r)
+    {
+        return l ^= r;
+    }
+
+    [[nodiscard]] bit_plane operator~() const
+    {
+        bit_plane r{*this};
+        r.flip();
+        return r;
+    }
+
+    // The plane with each element moved by (`dx`, `dy`). Elements moved out
+    // are dropped, and those moved in are `false`.
+    [[nodiscard]] bit_plane
+    shifted(const std::ptrdiff_t dx, const std::ptrdiff_t dy) const
+    {
+        bit_plane r{sz};
+        const auto h{static_cast<std::ptrdiff_t>(sz.h())};
+        for (std::ptrdiff_t y{std::max(dy, std::ptrdiff_t{0})};
+             y < std::min(h, h + dy); ++y)
+        {
+            const std::span<const word_type> from{
+                row(static_cast<std::size_t>(y - dy))};
+            word_type* const to{
+                r.words.data() + static_cast<std::size_t>(y) * row_words};
+            for (std::size_t k{0}; k != row_words; ++k)
+                to[k] = load_bits(
+                    from, static_cast<std::ptrdiff_t>(k * word_bits) - dx);
+        }
+        r.clear_padding();
+        return r;
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // The words of row `y`. Bit `x % 64` of word `x / 64` is element `x`.
+    [[nodiscard]] std::span<const word_type>
+    row(const std::size_t y) const noexcept
+    {
+        assert(y < sz.h());
+        return std::span{words}.subspan(y * row_words, row_words);
+    }
+
+    [[nodiscard]] bool operator==(const bit_plane& other) const noexcept
+    {
+        return sz == other.sz && words == other.words;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_BIT_PLANE_HPP
@@ -0,0 +1,270 @@
+#ifndef JGE_BLIT_HPP
+#define JGE_BLIT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+
+// Bulk copies and fills between subplanes of planes and plane views.
+// Regions are in signed coordinates, and are clipped against both planes.
+
+namespace jge
+{
+// Copy `from` of the source to the destination, with its top left at `to`.
+struct blit_command
+{
+    subplane<std::ptrdiff_t> from;
+    point2d<std::ptrdiff_t> to;
+
+    [[nodiscard]] friend constexpr bool
+    operator==(const blit_command&, const blit_command&) = default;
+};
+
+namespace detail
+{
+    // A `blit_command` clipped against a source of size `from` and a
+    // destination of size `to`. `size` is empty when nothing is left.
+    struct clipped_blit
+    {
+        point2d<std::size_t> from;
+        point2d<std::size_t> to;
+        size2d<std::size_t> size;
+    };
+
+    constexpr clipped_blit clip(
+        blit_command c, const size2d<std::size_t> from,
+        const size2d<std::size_t> to) noexcept
+    {
+        std::ptrdiff_t x0{c.from.top_left.x()};
+        std::ptrdiff_t y0{c.from.top_left.y()};
+        std::ptrdiff_t x1{x0 + c.from.size.w()};
+        std::ptrdiff_t y1{y0 + c.from.size.h()};
+        std::ptrdiff_t tx{c.to.x()};
+        std::ptrdiff_t ty{c.to.y()};
+        // Moves the start of the region forward by `d`, on both planes.
+        const auto skip{[](std::ptrdiff_t& a, std::ptrdiff_t& b,
+                           const std::ptrdiff_t d) {
+            if (d > 0)
+            {
+                a += d;
+                b += d;
+            }
+        }};
+        skip(x0, tx, -x0);
+        skip(y0, ty, -y0);
+        skip(x0, tx, -tx);
+        skip(y0, ty, -ty);
+        x1 = std::min(
+            {x1, static_cast<std::ptrdiff_t>(from.w()),
+             x0 + static_cast<std::ptrdiff_t>(to.w()) - tx});
+        y1 = std::min(
+            {y1, static_cast<std::ptrdiff_t>(from.h()),
+             y0 + static_cast<std::ptrdiff_t>(to.h()) - ty});
+        if (x1 <= x0 || y1 <= y0)
+            return {};
+        const auto u{[](const std::ptrdiff_t v) {
+            return static_cast<std::size_t>(v);
+        }};
+        return {
+            abscissa{u(x0)} + ordinate{u(y0)},
+            abscissa{u(tx)} + ordinate{u(ty)},
+            width{u(x1 - x0)} + height{u(y1 - y0)}};
+    }
+
+    template <class T>
+    inline constexpr bool memcpyable_v = std::is_trivially_copyable_v<T>;
+
+    // Whether `l` is before `r` in the same buffer. Elements of different
+    // types never share one.
+    template <class T, class U>
+    bool is_before(T* const l, U* const r) noexcept
+    {
+        if constexpr (std::is_same_v<
+                          std::remove_cv_t<T>, std::remove_cv_t<U>>)
+            return std::less<const volatile T*>{}(l, r);
+        else
+            return false;
+    }
+
+    // Copies the `n` elements at `from` to `to`, which may overlap.
+    template <class T, class U>
+    void copy_elements(T* const from, const std::size_t n, U* const to)
+    {
+        if constexpr (
+            std::is_same_v<std::remove_cv_t<T>, U> && memcpyable_v<U>)
+            std::memmove(to, from, n * sizeof(U));
+        else if (is_before(from, to))
+            std::copy_backward(from, from + n, to + n);
+        else
+            std::copy(from, from + n, to);
+    }
+
+    template <class T, class U>
+    constexpr void blit(
+        const plane_view<T> from, const plane_view<U> to,
+        const clipped_blit& c)
+    {
+        if (to1d(c.size) == 0)
+            return;
+        const plane_view<T> src{from.subview({c.from, c.size})};
+        const plane_view<U> dst{to.subview({c.to, c.size})};
+        const std::size_t h{c.size.h()};
+        if (std::is_constant_evaluated())
+        {
+            // Pointers into different objects have no order here, so the
+            // source is copied out first in case both views share a buffer.
+            std::vector<std::remove_cv_t<T>> buffer;
+            buffer.reserve(to1d(c.size));
+            for (std::size_t y{0}; y != h; ++y)
+            {
+                const std::span<T> row{src.row(y)};
+                buffer.insert(buffer.end(), row.begin(), row.end());
+            }
+            for (std::size_t y{0}; y != h; ++y)
+                std::ranges::copy(
+                    std::span{buffer}.subspan(y * c.size.w(), c.size.w()),
+                    dst.row(y).begin());
+            return;
+        }
+        // Rows are copied in the order that does not overwrite rows still
+        // to be read, in case both views share a buffer.
+        const bool backward{is_before(src.data(), dst.data())};
+        for (std::size_t i{0}; i != h; ++i)
+        {
+            const std::size_t y{backward ? h - 1 - i : i};
+            copy_elements(src.row(y).data(), c.size.w(), dst.row(y).data());
+        }
+    }
+
+} // namespace detail
+
+// Copies subplane `from_region` of `from` to `to`, with its top left at
+// `to_point`, clipped against both planes.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void blit(
+    From&& from, const subplane<std::ptrdiff_t> from_region, To&& to,
+    const point2d<std::ptrdiff_t> to_point)
+{
+    const plane_view f{std::forward<From>(from)};
+    const plane_view t{std::forward<To>(to)};
+    detail::blit(
+        f, t, detail::clip({from_region, to_point}, f.size(), t.size()));
+}
+
+// Executes each command, in order, from `from` to `to`, like composing a
+// layer of tiles from a tileset.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void
+blit(From&& from, const std::span<const blit_command> commands, To&& to)
+{
+    const plane_view f{std::forward<From>(from)};
+    const plane_view t{std::forward<To>(to)};
+    for (const blit_command& c : commands)
+        detail::blit(f, t, detail::clip(c, f.size(), t.size()));
+}
+
+// Assigns `value` to each element of subplane `region` of `to`, clipped
+// against it.
+template <detail::viewable_plane To, class T>
+constexpr void
+fill(To&& to, const subplane<std::ptrdiff_t> region, const T& value)
+{
+    const plane_view t{std::forward<To>(to)};
+    using U = typename decltype(t)::element_type;
+    const detail::clipped_blit c{detail::clip(
+        {region, region.top_left}, t.size(), t.size())};
+    if (to1d(c.size) == 0)
+        return;
+    const plane_view<U> dst{t.subview({c.to, c.size})};
+    for (std::size_t y{0}; y != c.size.h(); ++y)
+    {
+        const std::span<U> row{dst.row(y)};
+        if constexpr (sizeof(U) == 1 && detail::memcpyable_v<U>)
+            if (!std::is_constant_evaluated())
+            {
+                const U v(value);
+                unsigned char byte;
+                std::memcpy(&byte, &v, 1);
+                std::memset(row.data(), byte, row.size());
+                continue;
+            }
+        std::ranges::fill(row, value);
+    }
+}
+
+namespace detail
+{
+    // Stitches `parts` along x if `along_x`, and along y otherwise.
+    template <class T, std::size_t N>
+    constexpr plane<T>
+    stitch(const std::array<plane_view<const T>, N>& parts, const bool along_x)
+    {
+        std::size_t w{0};
+        std::size_t h{0};
+        for (const plane_view<const T> p : parts)
+        {
+            assert(
+                along_x ? p.size().h() == parts[0].size().h()
+                        : p.size().w() == parts[0].size().w());
+            w = along_x ? w + p.size().w() : p.size().w();
+            h = along_x ? p.size().h() : h + p.size().h();
+        }
+        if (w == 0 || h == 0)
+            return {};
+        plane<T> res{width{w} + height{h}, default_initialize};
+        std::ptrdiff_t offset{0};
+        for (const plane_view<const T> p : parts)
+        {
+            const auto at{
+                along_x ? abscissa{offset} + ordinate{std::ptrdiff_t{0}}
+                        : abscissa{std::ptrdiff_t{0}} + ordinate{offset}};
+            blit(p, {{}, p.size()}, res, at);
+            offset += static_cast<std::ptrdiff_t>(
+                along_x ? p.size().w() : p.size().h());
+        }
+        return res;
+    }
+
+} // namespace detail
+
+// The plane of `parts`, which are of equal height, side by side from left
+// to right.
+template <detail::viewable_plane P, detail::viewable_plane... Ps>
+[[nodiscard]] constexpr plane<detail::view_value_t<P>>
+stitch_x(P&& p, Ps&&... ps)
+{
+    using T = detail::view_value_t<P>;
+    return detail::stitch(
+        std::array<plane_view<const T>, 1 + sizeof...(Ps)>{
+            plane_view{std::forward<P>(p)},
+            plane_view{std::forward<Ps>(ps)}...},
+        true);
+}
+
+// The plane of `parts`, which are of equal width, one below the other from
+// top to bottom.
+template <detail::viewable_plane P, detail::viewable_plane... Ps>
+[[nodiscard]] constexpr plane<detail::view_value_t<P>>
+stitch_y(P&& p, Ps&&... ps)
+{
+    using T = detail::view_value_t<P>;
+    return detail::stitch(
+        std::array<plane_view<const T>, 1 + sizeof...(Ps)>{
+            plane_view{std::forward<P>(p)},
+            plane_view{std::forward<Ps>(ps)}...},
+        false);
+}
+
+} // namespace jge
+
+#endif // JGE_BLIT_HPP
@@ -0,0 +1,176 @@
+#ifndef JGE_BUFFERED_PLANE_HPP
+#define JGE_BUFFERED_PLANE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// What the back buffer of a `buffered_plane` holds after `publish()`.
+enum class buffer_sync
+{
+    // An older frame; the writer overwrites every element of each frame.
+    none,
+    // The published frame, by copying every row.
+    all_rows,
+    // The published frame, by copying only the rows written since the back
+    // buffer last held a frame.
+    dirty_rows
+};
+
+// A triple-buffered plane that hands frames over from one writer thread to
+// one reader thread without locks. The writer writes to the back buffer and
+// publishes it; the reader acquires the latest published frame as its front
+// buffer. Neither ever waits for the other, and the reader always sees a
+// whole frame.
+template <std::copyable T>
+class [[nodiscard]] buffered_plane
+{
+public:
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+private:
+    static constexpr std::uint8_t fresh{0b100};
+    static constexpr std::uint8_t index_mask{0b011};
+    static constexpr std::size_t cache_line{64};
+
+    std::array<plane<T>, 3> buffers;
+
+    // The index of the buffer between the writer and the reader, and whether
+    // it holds a frame that the reader has not acquired yet.
+    alignas(cache_line) std::atomic<std::uint8_t> middle{1};
+
+    // Owned by the writer.
+    alignas(cache_line) std::uint8_t back_index{0};
+    buffer_sync sync;
+    std::uint64_t frame{1};
+    std::array<std::uint64_t, 3> buffer_frames{};
+    std::vector<std::uint64_t> row_frames;
+
+    // Owned by the reader.
+    alignas(cache_line) std::uint8_t front_index{2};
+
+    plane<T>& back_buffer() noexcept
+    {
+        return buffers[back_index];
+    }
+
+    void mark_written(const std::size_t y) noexcept
+    {
+        if (sync == buffer_sync::dirty_rows)
+            row_frames[y] = frame;
+    }
+
+    std::span<T> buffer_row(plane<T>& p, const std::size_t y) noexcept
+    {
+        return to1d(p).subspan(y * size().w(), size().w());
+    }
+
+public:
+    explicit buffered_plane(
+        const plane<T>& initial, const buffer_sync sync = buffer_sync::all_rows)
+      : buffers{initial, initial, initial},
+        sync{sync},
+        row_frames(sync == buffer_sync::dirty_rows ? initial.size().h() : 0)
+    {
+    }
+
+    explicit buffered_plane(
+        const size_type sz, value_initialize_t,
+        const buffer_sync sync = buffer_sync::all_rows) requires
+        std::default_initializable<T>
+      : buffered_plane{plane<T>{sz, value_initialize}, sync}
+    {
+    }
+
+    buffered_plane(const buffered_plane&) = delete;
+    buffered_plane& operator=(const buffered_plane&) = delete;
+
+    size_type size() const noexcept
+    {
+        return buffers[0].size();
+    }
+
+    // Writer interface.
+
+    [[nodiscard]] T& operator[](const point_type pt) noexcept
+    {
+        mark_written(pt.y());
+        return back_buffer()[pt];
+    }
+
+    [[nodiscard]] std::span<T> row(const std::size_t y) noexcept
+    {
+        assert(y < size().h());
+        mark_written(y);
+        return buffer_row(back_buffer(), y);
+    }
+
+    // The whole back buffer. Counts every row as written.
+    [[nodiscard]] plane<T>& back() noexcept
+    {
+        std::ranges::fill(row_frames, frame);
+        return back_buffer();
+    }
+
+    // Makes the back buffer the latest frame, and continues on a buffer that
+    // the reader does not use.
+    void publish()
+    {
+        const std::uint8_t published{back_index};
+        buffer_frames[published] = frame;
+        back_index =
+            middle.exchange(published | fresh, std::memory_order_acq_rel) &
+            index_mask;
+
+        plane<T>& from{buffers[published]};
+        plane<T>& to{back_buffer()};
+        if (sync == buffer_sync::all_rows)
+            std::ranges::copy(to1d(std::as_const(from)), to1d(to).begin());
+        else if (sync == buffer_sync::dirty_rows)
+            for (std::size_t y{0}; y != size().h(); ++y)
+                if (row_frames[y] > buffer_frames[back_index])
+                    std::ranges::copy(
+                        buffer_row(from, y), buffer_row(to, y).begin());
+        buffer_frames[back_index] = frame;
+        ++frame;
+    }
+
+    // Reader interface.
+
+    // Whether a frame was published since the last `acquire()`.
+    [[nodiscard]] bool has_new_frame() const noexcept
+    {
+        return (middle.load(std::memory_order_relaxed) & fresh) != 0;
+    }
+
+    // Makes the latest published frame, if any, the front buffer.
+    const plane<T>& acquire() noexcept
+    {
+        if (has_new_frame())
+            front_index =
+                middle.exchange(front_index, std::memory_order_acq_rel) &
+                index_mask;
+        return front();
+    }
+
+    [[nodiscard]] const plane<T>& front() const noexcept
+    {
+        return buffers[front_index];
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_BUFFERED_PLANE_HPP
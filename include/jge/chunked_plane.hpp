@@ -0,0 +1,194 @@
+#ifndef JGE_CHUNKED_PLANE_HPP
+#define JGE_CHUNKED_PLANE_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/static_plane.hpp>
+
+namespace jge
+{
+// An unbounded plane, stored as `ChunkW`x`ChunkH` chunks that are only
+// allocated once an element in them is written.
+// Reading an element of a missing chunk yields the background value.
+template <
+    class T, std::size_t ChunkW = 32, std::size_t ChunkH = ChunkW,
+    class Allocator = std::allocator<T>>
+class [[nodiscard]] chunked_plane
+{
+    static_assert(ChunkW != 0 && ChunkH != 0);
+
+public:
+    using allocator_type = Allocator;
+    using chunk_type     = static_plane<T, ChunkW, ChunkH>;
+    using width_type     = width<std::ptrdiff_t>;
+    using size_type      = size2d<width_type::rep>;
+    using point_type     = point2d<size_type::rep>;
+
+    static constexpr size_type chunk_size{
+        width_type{ChunkW}, height<std::ptrdiff_t>{ChunkH}};
+
+private:
+    struct point_hash
+    {
+        std::size_t operator()(const point_type pt) const noexcept
+        {
+            return std::hash<std::size_t>{}(
+                static_cast<std::size_t>(pt.x()) * 0x9E3779B97F4A7C15u ^
+                static_cast<std::size_t>(pt.y()));
+        }
+    };
+
+    using index_type = std::unordered_map<
+        point_type, chunk_type, point_hash, std::equal_to<>,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            std::pair<const point_type, chunk_type>>>;
+
+    index_type index;
+    T background_value{};
+
+    static constexpr std::ptrdiff_t
+    floor_multiple(const std::ptrdiff_t v, const std::ptrdiff_t n) noexcept
+    {
+        return v - (v % n + n) % n;
+    }
+
+    static constexpr typename chunk_type::point_type
+    chunk_point(const point_type pt) noexcept
+    {
+        const point_type origin{chunk_origin(pt)};
+        return {
+            abscissa<std::size_t>(pt.x() - origin.x()),
+            ordinate<std::size_t>(pt.y() - origin.y())};
+    }
+
+public:
+    chunked_plane() = default;
+
+    explicit chunked_plane(const Allocator& a) : index{a}
+    {
+    }
+
+    explicit chunked_plane(
+        const T& background, const Allocator& a = Allocator())
+      : index{a}, background_value{background}
+    {
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return index.get_allocator();
+    }
+
+    // The top-left point of the chunk that contains `pt`.
+    [[nodiscard]] static constexpr point_type
+    chunk_origin(const point_type pt) noexcept
+    {
+        return {
+            abscissa{floor_multiple(pt.x(), ChunkW)},
+            ordinate{floor_multiple(pt.y(), ChunkH)}};
+    }
+
+    [[nodiscard]] const T& background() const noexcept
+    {
+        return background_value;
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        const chunk_type* const c{find_chunk(pt)};
+        return c == nullptr ? background_value : (*c)[chunk_point(pt)];
+    }
+
+    // Returns the element at `pt` for writing, allocating its chunk, filled
+    // with the background value, if it is missing.
+    [[nodiscard]] T& touch(const point_type pt) requires std::copyable<T>
+    {
+        auto [it, inserted]{
+            index.try_emplace(chunk_origin(pt), default_initialize)};
+        if (inserted)
+            std::ranges::fill(to1d(it->second), background_value);
+        return it->second[chunk_point(pt)];
+    }
+
+    [[nodiscard]] chunk_type* find_chunk(const point_type pt) noexcept
+    {
+        const auto it{index.find(chunk_origin(pt))};
+        return it == index.end() ? nullptr : &it->second;
+    }
+
+    [[nodiscard]] const chunk_type*
+    find_chunk(const point_type pt) const noexcept
+    {
+        return const_cast<chunked_plane&>(*this).find_chunk(pt);
+    }
+
+    // Erases the chunk that contains `pt`, so that its elements read as the
+    // background value.
+    void erase_chunk(const point_type pt) noexcept
+    {
+        index.erase(chunk_origin(pt));
+    }
+
+    void clear() noexcept
+    {
+        index.clear();
+    }
+
+    [[nodiscard]] std::size_t chunk_count() const noexcept
+    {
+        return index.size();
+    }
+
+    // The allocated chunks, in no particular order, as pairs of their origin
+    // and their elements.
+    [[nodiscard]] auto chunks() noexcept
+    {
+        return std::views::all(index);
+    }
+
+    [[nodiscard]] auto chunks() const noexcept
+    {
+        return std::views::all(index);
+    }
+
+    // The smallest subplane that covers all allocated chunks.
+    [[nodiscard]] subplane<std::ptrdiff_t> bounds() const noexcept
+    {
+        if (index.empty())
+            return {};
+        auto keys{index | std::views::keys};
+        const auto [min_x, max_x]{std::ranges::minmax(
+            keys | std::views::transform([](const point_type pt) {
+                return pt.x();
+            }))};
+        const auto [min_y, max_y]{std::ranges::minmax(
+            keys | std::views::transform([](const point_type pt) {
+                return pt.y();
+            }))};
+        return {
+            abscissa{min_x} + ordinate{min_y},
+            width_type{max_x + std::ptrdiff_t{ChunkW} - min_x} +
+                height<std::ptrdiff_t>{max_y + std::ptrdiff_t{ChunkH} - min_y}};
+    }
+};
+
+namespace pmr
+{
+    template <class T, std::size_t ChunkW = 32, std::size_t ChunkH = ChunkW>
+    using chunked_plane = jge::
+        chunked_plane<T, ChunkW, ChunkH, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+} // namespace jge
+
+#endif // JGE_CHUNKED_PLANE_HPP
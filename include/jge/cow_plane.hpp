@@ -0,0 +1,187 @@
+#ifndef JGE_COW_PLANE_HPP
+#define JGE_COW_PLANE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// A plane whose copies share their elements in bands of `BandRows` rows.
+// Writing to a shared band first copies that band alone.
+// Reading never copies: prefer `std::as_const` when only reading through a
+// non-const plane.
+// A plane and its copies may be used by different threads, like snapshots
+// handed to a renderer, as long as each is used by one thread at a time.
+template <std::copyable T, std::size_t BandRows = 16>
+class [[nodiscard]] cow_plane
+{
+    static_assert(BandRows != 0);
+
+public:
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+    static constexpr std::size_t band_rows{BandRows};
+
+private:
+    size_type sz{};
+    std::vector<std::shared_ptr<plane<T>>> bands;
+
+    static constexpr std::size_t band_count(const size_type sz) noexcept
+    {
+        return (sz.h() + BandRows - 1) / BandRows;
+    }
+
+    size_type band_size(const std::size_t b) const noexcept
+    {
+        return {sz.w, height{std::min(BandRows, sz.h() - b * BandRows)}};
+    }
+
+    static point_type band_point(const point_type pt) noexcept
+    {
+        return {pt.x, ordinate{pt.y() % BandRows}};
+    }
+
+    // Gives `*this` sole ownership of band `b`, copying it if shared.
+    plane<T>& unshare(const std::size_t b)
+    {
+        std::shared_ptr<plane<T>>& band{bands[b]};
+        if (band.use_count() != 1)
+            band = std::make_shared<plane<T>>(*band);
+        else
+            // `use_count` is a relaxed load. Synchronize with the release of
+            // the last copy, by another thread, before writing in place.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        return *band;
+    }
+
+    template <class R>
+    void create_from(R&& r, const width_type w)
+    {
+        sz = to_size(std::ranges::size(r), w);
+        bands.reserve(band_count(sz));
+        auto it{std::ranges::begin(r)};
+        for (std::size_t b{0}; b != band_count(sz); ++b)
+        {
+            const std::size_t n{to1d(band_size(b))};
+            bands.push_back(std::make_shared<plane<T>>(
+                std::ranges::subrange{it, std::ranges::next(it, n), n}, w));
+            std::ranges::advance(it, n);
+        }
+    }
+
+public:
+    cow_plane() = default;
+
+    explicit cow_plane(const size_type sz, value_initialize_t) requires
+        std::default_initializable<T> : sz{sz}
+    {
+        assert(sz == size_type{} || to1d(sz) != 0);
+        bands.reserve(band_count(sz));
+        for (std::size_t b{0}; b != band_count(sz); ++b)
+            bands.push_back(
+                std::make_shared<plane<T>>(band_size(b), value_initialize));
+    }
+
+    cow_plane(const std::initializer_list<std::initializer_list<T>> il2d)
+      : cow_plane{plane<T>{il2d}}
+    {
+    }
+
+    template <std::ranges::sized_range R>
+        requires std::ranges::forward_range<R> &&
+            std::constructible_from<T, std::ranges::range_reference_t<R>>
+    cow_plane(R&& r, const width_type w)
+    {
+        create_from(std::forward<R>(r), w);
+    }
+
+    template <class Allocator>
+    explicit cow_plane(const plane<T, Allocator>& p)
+    {
+        create_from(to1d(p), p.size().w);
+    }
+
+    template <class Allocator>
+    explicit operator plane<T, Allocator>() const
+    {
+        auto elements{to1d(*this)};
+        return {
+            std::ranges::subrange{
+                elements.begin(), elements.end(), to1d(sz)},
+            sz.w};
+    }
+
+    [[nodiscard]] T& operator[](const point_type pt)
+    {
+        assert(contains(sz, pt));
+        return unshare(pt.y() / BandRows)[band_point(pt)];
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return (*bands[pt.y() / BandRows])[band_point(pt)];
+    }
+
+    [[nodiscard]] std::span<T> row(const std::size_t y)
+    {
+        assert(y < sz.h());
+        return to1d(unshare(y / BandRows))
+            .subspan(y % BandRows * sz.w(), sz.w());
+    }
+
+    [[nodiscard]] std::span<const T> row(const std::size_t y) const noexcept
+    {
+        assert(y < sz.h());
+        return to1d(std::as_const(*bands[y / BandRows]))
+            .subspan(y % BandRows * sz.w(), sz.w());
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // The number of bands whose elements are shared with another plane.
+    [[nodiscard]] std::size_t shared_band_count() const noexcept
+    {
+        return std::ranges::count_if(
+            bands, [](const auto& band) { return band.use_count() != 1; });
+    }
+
+    [[nodiscard]] bool operator==(const cow_plane& other) const
+        noexcept requires std::equality_comparable<T>
+    {
+        return sz == other.sz &&
+               std::ranges::equal(
+                   bands, other.bands, [](const auto& l, const auto& r) {
+                       return l == r || *l == *r;
+                   });
+    }
+
+    // The elements, in row-major order, without copying any band.
+    [[nodiscard]] friend auto to1d(const cow_plane& p) noexcept
+    {
+        return p.bands | std::views::transform([](const auto& band) {
+                   return to1d(std::as_const(*band));
+               }) |
+               std::views::join;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_COW_PLANE_HPP
@@ -3,29 +3,80 @@
 
 #include <iterator>
 #include <memory>
+#include <ranges>
 #include <type_traits>
 #include <utility>
 
 namespace jge::detail
 {
-inline constexpr bool default_allocator_is_nothrow{false};
+template <class Allocator>
+inline constexpr bool allocator_is_nothrow{false};
+
+inline constexpr auto destroy =
+    []<class Allocator, std::ranges::forward_range R>(Allocator & alloc, R && r)
+        noexcept -> std::ranges::borrowed_iterator_t<R>
+{
+    using traits = std::allocator_traits<Allocator>;
+    auto first{std::ranges::begin(r)};
+    auto last{std::ranges::end(r)};
+    if constexpr (std::is_trivially_destructible_v<
+                      std::ranges::range_value_t<R>>)
+        std::ranges::advance(first, last);
+    else
+        for (; first != last; ++first)
+            traits::destroy(alloc, std::to_address(first));
+    return first;
+};
 
 inline constexpr auto uninitialized_value_construct =
-    []<class R>(R && r) -> std::ranges::borrowed_iterator_t<R>
+    []<class Allocator, class R>(Allocator & alloc, R && r)
+    -> std::ranges::borrowed_iterator_t<R>
     requires requires
     {
         std::ranges::uninitialized_value_construct(std::forward<R>(r));
     }
 {
+    using traits = std::allocator_traits<Allocator>;
     auto first{std::ranges::begin(r)};
     auto last{std::ranges::end(r)};
-    for (; first != last; ++first)
-        std::construct_at(std::to_address(first));
-    return first;
+    auto current{first};
+    try
+    {
+        for (; current != last; ++current)
+            traits::construct(alloc, std::to_address(current));
+    }
+    catch (...)
+    {
+        destroy(alloc, std::ranges::subrange{first, current});
+        throw;
+    }
+    return current;
+};
+
+// Like `uninitialized_value_construct`, but leaves trivial elements
+// uninitialized, as `new T[n]` would.
+inline constexpr auto uninitialized_default_construct =
+    []<class Allocator, class R>(Allocator & alloc, R && r)
+    -> std::ranges::borrowed_iterator_t<R>
+    requires requires
+    {
+        std::ranges::uninitialized_default_construct(std::forward<R>(r));
+    }
+{
+    if constexpr (std::is_trivially_default_constructible_v<
+                      std::ranges::range_value_t<R>>)
+    {
+        auto first{std::ranges::begin(r)};
+        std::ranges::advance(first, std::ranges::end(r));
+        return first;
+    }
+    else
+        return uninitialized_value_construct(alloc, std::forward<R>(r));
 };
 
 inline constexpr auto uninitialized_copy =
-    []<class IR, class OR>(IR && in_range, OR&& out_range)
+    []<class Allocator, class IR, class OR>(
+        Allocator & alloc, IR && in_range, OR && out_range)
     -> std::ranges::uninitialized_copy_result<
         std::ranges::borrowed_iterator_t<IR>,
         std::ranges::borrowed_iterator_t<OR>>
@@ -35,13 +86,23 @@ inline constexpr auto uninitialized_copy =
             std::forward<IR>(in_range), std::forward<OR>(out_range));
     }
 {
+    using traits = std::allocator_traits<Allocator>;
     auto ifirst{std::ranges::begin(in_range)};
     auto ilast{std::ranges::end(in_range)};
     auto ofirst{std::ranges::begin(out_range)};
     auto olast{std::ranges::end(out_range)};
-    for (; ifirst != ilast && ofirst != olast; ++ofirst, (void)++ifirst)
-        std::construct_at(std::to_address(ofirst), *ifirst);
-    return {std::move(ifirst), ofirst};
+    auto ocurrent{ofirst};
+    try
+    {
+        for (; ifirst != ilast && ocurrent != olast; ++ocurrent, (void)++ifirst)
+            traits::construct(alloc, std::to_address(ocurrent), *ifirst);
+    }
+    catch (...)
+    {
+        destroy(alloc, std::ranges::subrange{ofirst, ocurrent});
+        throw;
+    }
+    return {std::move(ifirst), ocurrent};
 };
 
 } // namespace jge::detail
@@ -0,0 +1,46 @@
+#ifndef JGE_DETAIL_PARALLEL_HPP
+#define JGE_DETAIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace jge::detail
+{
+// Splits [0, n) into contiguous bands of at least `min_band` indices, and
+// calls `f(first, last)` for each band on its own thread.
+// The calling thread processes the first band, and the bands of any thread
+// that fails to start, so that every band is processed before returning.
+inline constexpr auto for_each_band =
+    [](const std::size_t n, const std::size_t min_band, auto f)
+{
+    const std::size_t threads{
+        std::max(std::thread::hardware_concurrency(), 1u)};
+    const std::size_t bands{
+        std::clamp(n / std::max(min_band, std::size_t{1}), std::size_t{1},
+                   threads)};
+    const std::size_t band{n / bands};
+    const std::size_t remainder{n % bands};
+    const auto first = [&](const std::size_t i) {
+        return i * band + std::min(i, remainder);
+    };
+    std::vector<std::jthread> workers;
+    std::size_t started{1};
+    try
+    {
+        workers.reserve(bands - 1);
+        for (; started < bands; ++started)
+            workers.emplace_back(f, first(started), first(started + 1));
+    }
+    catch (...)
+    {
+    }
+    f(first(0), first(1));
+    if (started < bands)
+        f(first(started), first(bands));
+};
+
+} // namespace jge::detail
+
+#endif // JGE_DETAIL_PARALLEL_HPP
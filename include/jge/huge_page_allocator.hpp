@@ -0,0 +1,127 @@
+#ifndef JGE_HUGE_PAGE_ALLOCATOR_HPP
+#define JGE_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <jge/plane.hpp>
+#if __has_include(<sys/mman.h>)
+#    include <sys/mman.h>
+#    define JGE_HAS_MMAN 1
+#else
+#    define JGE_HAS_MMAN 0
+#endif
+
+namespace jge
+{
+// An allocator that backs large allocations with anonymous memory mappings
+// aligned to, and advised for, transparent huge pages.
+// Where huge pages are unavailable, the mappings get regular pages.
+// Small allocations, allocations during constant evaluation and all
+// allocations on systems without `mmap` go through `std::allocator`.
+template <class T>
+class huge_page_allocator
+{
+public:
+    using value_type                             = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal                        = std::true_type;
+
+    static constexpr std::size_t huge_page_size{std::size_t{2} << 20};
+
+    // Allocations of at least this many bytes are mapped.
+    static constexpr std::size_t threshold{huge_page_size / 2};
+
+    huge_page_allocator() = default;
+
+    template <class U>
+    constexpr huge_page_allocator(const huge_page_allocator<U>&) noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr T* allocate(const std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length{};
+#if JGE_HAS_MMAN
+        if (!std::is_constant_evaluated() && is_mapped(n))
+        {
+            // Rounding to huge pages, and the oversized mapping, must not wrap.
+            if (n * sizeof(T) >
+                std::numeric_limits<std::size_t>::max() - 2 * huge_page_size)
+                throw std::bad_alloc{};
+            return static_cast<T*>(map(mapped_bytes(n)));
+        }
+#endif
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    constexpr void deallocate(T* const p, const std::size_t n) noexcept
+    {
+#if JGE_HAS_MMAN
+        if (!std::is_constant_evaluated() && is_mapped(n))
+        {
+            ::munmap(p, mapped_bytes(n));
+            return;
+        }
+#endif
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    [[nodiscard]] constexpr bool
+    operator==(const huge_page_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+    static constexpr bool is_mapped(const std::size_t n) noexcept
+    {
+        return n * sizeof(T) >= threshold;
+    }
+
+    static constexpr std::size_t mapped_bytes(const std::size_t n) noexcept
+    {
+        return (n * sizeof(T) + huge_page_size - 1) / huge_page_size *
+               huge_page_size;
+    }
+
+#if JGE_HAS_MMAN
+    // Maps `bytes` aligned to a huge page by trimming an oversized mapping.
+    static void* map(const std::size_t bytes)
+    {
+        const std::size_t oversized{bytes + huge_page_size};
+        void* const mapping{::mmap(
+            nullptr, oversized, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+        if (mapping == MAP_FAILED)
+            throw std::bad_alloc{};
+        auto* const first{static_cast<std::byte*>(mapping)};
+        const std::size_t misalignment{
+            reinterpret_cast<std::uintptr_t>(first) % huge_page_size};
+        const std::size_t head{
+            misalignment == 0 ? 0 : huge_page_size - misalignment};
+        if (head != 0)
+            ::munmap(first, head);
+        ::munmap(first + head + bytes, huge_page_size - head);
+#    ifdef MADV_HUGEPAGE
+        // Failure only means that the mapping keeps regular pages.
+        ::madvise(first + head, bytes, MADV_HUGEPAGE);
+#    endif
+        return first + head;
+    }
+#endif
+};
+
+template <class T>
+using huge_page_plane = plane<T, huge_page_allocator<T>>;
+
+} // namespace jge
+
+#undef JGE_HAS_MMAN
+
+#endif // JGE_HUGE_PAGE_ALLOCATOR_HPP
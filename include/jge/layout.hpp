@@ -0,0 +1,202 @@
+#ifndef JGE_LAYOUT_HPP
+#define JGE_LAYOUT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <jge/cartesian.hpp>
+#ifdef __BMI2__
+#    include <immintrin.h>
+#endif
+
+namespace jge
+{
+// Layout policies map the points of a plane of a given size to the indices of
+// its storage. A policy's `mapping`, constructed from the size, provides
+// - `storage_size()`, the size of the storage, which may include padding,
+// - `to1d(pt)`, the storage index of `pt`, and
+// - `to2d(i)`, the point at storage index `i`, which lies outside the size
+//   for indices of padding.
+
+// The layout of `plane`: rows one after another.
+struct layout_row_major
+{
+    class mapping
+    {
+        size2d<std::size_t> sz;
+
+    public:
+        constexpr explicit mapping(const size2d<std::size_t> sz) noexcept
+          : sz{sz}
+        {
+        }
+
+        [[nodiscard]] constexpr size2d<std::size_t>
+        storage_size() const noexcept
+        {
+            return sz;
+        }
+
+        [[nodiscard]] constexpr std::size_t
+        to1d(const point2d<std::size_t> pt) const noexcept
+        {
+            return jge::to1d(pt, sz);
+        }
+
+        [[nodiscard]] constexpr point2d<std::size_t>
+        to2d(const std::size_t i) const noexcept
+        {
+            return jge::to2d(i, sz.w);
+        }
+    };
+};
+
+// Square `Tile`x`Tile` blocks, with the blocks and the elements within each
+// block in row-major order. The storage is padded to whole blocks.
+template <std::size_t Tile>
+struct layout_tiled
+{
+    static_assert(Tile != 0);
+
+    class mapping
+    {
+        size2d<std::size_t> sz;
+        std::size_t tiles_per_row;
+
+        static constexpr std::size_t tiles(const std::size_t n) noexcept
+        {
+            return (n + Tile - 1) / Tile;
+        }
+
+    public:
+        constexpr explicit mapping(const size2d<std::size_t> sz) noexcept
+          : sz{sz}, tiles_per_row{tiles(sz.w())}
+        {
+        }
+
+        [[nodiscard]] constexpr size2d<std::size_t>
+        storage_size() const noexcept
+        {
+            return {
+                width{tiles_per_row * Tile}, height{tiles(sz.h()) * Tile}};
+        }
+
+        [[nodiscard]] constexpr std::size_t
+        to1d(const point2d<std::size_t> pt) const noexcept
+        {
+            assert(contains(storage_size(), pt));
+            const std::size_t tile{
+                pt.y() / Tile * tiles_per_row + pt.x() / Tile};
+            return (tile * Tile + pt.y() % Tile) * Tile + pt.x() % Tile;
+        }
+
+        [[nodiscard]] constexpr point2d<std::size_t>
+        to2d(const std::size_t i) const noexcept
+        {
+            assert(tiles_per_row != 0);
+            const std::size_t tile{i / (Tile * Tile)};
+            const std::size_t in_tile{i % (Tile * Tile)};
+            return {
+                abscissa{tile % tiles_per_row * Tile + in_tile % Tile},
+                ordinate{tile / tiles_per_row * Tile + in_tile / Tile}};
+        }
+    };
+};
+
+namespace detail
+{
+    // Spreads the low 32 bits of `v` to the even bits of the result.
+    constexpr std::uint64_t spread_bits(std::uint64_t v) noexcept
+    {
+#ifdef __BMI2__
+        if (!std::is_constant_evaluated())
+            return _pdep_u64(v, 0x5555'5555'5555'5555);
+#endif
+        v &= 0xFFFF'FFFF;
+        v = (v | v << 16) & 0x0000'FFFF'0000'FFFF;
+        v = (v | v << 8) & 0x00FF'00FF'00FF'00FF;
+        v = (v | v << 4) & 0x0F0F'0F0F'0F0F'0F0F;
+        v = (v | v << 2) & 0x3333'3333'3333'3333;
+        v = (v | v << 1) & 0x5555'5555'5555'5555;
+        return v;
+    }
+
+    // The inverse of `spread_bits`.
+    constexpr std::uint64_t gather_bits(std::uint64_t v) noexcept
+    {
+#ifdef __BMI2__
+        if (!std::is_constant_evaluated())
+            return _pext_u64(v, 0x5555'5555'5555'5555);
+#endif
+        v &= 0x5555'5555'5555'5555;
+        v = (v | v >> 1) & 0x3333'3333'3333'3333;
+        v = (v | v >> 2) & 0x0F0F'0F0F'0F0F'0F0F;
+        v = (v | v >> 4) & 0x00FF'00FF'00FF'00FF;
+        v = (v | v >> 8) & 0x0000'FFFF'0000'FFFF;
+        v = (v | v >> 16) & 0x0000'0000'FFFF'FFFF;
+        return v;
+    }
+
+} // namespace detail
+
+// Z-order: the bits of the coordinates interleaved, so that nearby points in
+// both axes are nearby in storage. The storage is padded to power-of-two
+// extents. When those differ, the square Z-orders are stacked along the longer
+// one.
+struct layout_morton
+{
+    class mapping
+    {
+        size2d<std::size_t> sz{};
+        int square_bits{};
+        bool wide{};
+
+    public:
+        constexpr explicit mapping(const size2d<std::size_t> logical) noexcept
+        {
+            assert(std::max(logical.w(), logical.h()) <= std::size_t{1} << 31);
+            if (logical == size2d<std::size_t>{})
+                return;
+            sz = {
+                width{std::bit_ceil(logical.w())},
+                height{std::bit_ceil(logical.h())}};
+            square_bits = std::countr_zero(std::min(sz.w(), sz.h()));
+            wide        = sz.w() > sz.h();
+        }
+
+        [[nodiscard]] constexpr size2d<std::size_t>
+        storage_size() const noexcept
+        {
+            return sz;
+        }
+
+        [[nodiscard]] constexpr std::size_t
+        to1d(const point2d<std::size_t> pt) const noexcept
+        {
+            assert(contains(sz, pt));
+            const std::size_t low{(std::size_t{1} << square_bits) - 1};
+            const std::size_t high{(pt.x() | pt.y()) >> square_bits};
+            return detail::spread_bits(pt.x() & low) |
+                   detail::spread_bits(pt.y() & low) << 1 |
+                   high << 2 * square_bits;
+        }
+
+        [[nodiscard]] constexpr point2d<std::size_t>
+        to2d(const std::size_t i) const noexcept
+        {
+            const std::size_t low{
+                i & ((std::size_t{1} << 2 * square_bits) - 1)};
+            std::size_t x{detail::gather_bits(low)};
+            std::size_t y{detail::gather_bits(low >> 1)};
+            (wide ? x : y) |= i >> 2 * square_bits << square_bits;
+            return {abscissa{x}, ordinate{y}};
+        }
+    };
+};
+
+} // namespace jge
+
+#endif // JGE_LAYOUT_HPP
@@ -0,0 +1,206 @@
+#ifndef JGE_LAYOUT_PLANE_HPP
+#define JGE_LAYOUT_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/layout.hpp>
+#include <jge/plane.hpp>
+#include <lift.hpp>
+
+namespace jge
+{
+// A plane whose elements are stored in the order of the `Layout` policy.
+// Storage padding is initialized like the elements, is only reachable
+// through `storage()`, and takes no part in comparisons.
+template <class T, class Layout, class Allocator = std::allocator<T>>
+class [[nodiscard]] layout_plane
+{
+public:
+    using layout_type    = Layout;
+    using mapping_type   = typename Layout::mapping;
+    using allocator_type = Allocator;
+    using width_type     = width<std::size_t>;
+    using size_type      = size2d<width_type::rep>;
+    using point_type     = point2d<size_type::rep>;
+
+private:
+    size_type sz{};
+    mapping_type map{size_type{}};
+    plane<T, Allocator> elements;
+
+public:
+    constexpr layout_plane() = default;
+
+    constexpr explicit layout_plane(const Allocator& a) noexcept : elements{a}
+    {
+    }
+
+    constexpr layout_plane(const layout_plane&) = default;
+    constexpr layout_plane& operator=(const layout_plane&) = default;
+
+    constexpr layout_plane(layout_plane&& other) noexcept
+      : sz{std::exchange(other.sz, {})},
+        map{std::exchange(other.map, mapping_type{size_type{}})},
+        elements{std::move(other.elements)}
+    {
+    }
+
+    constexpr layout_plane& operator=(layout_plane&& other) noexcept(
+        std::is_nothrow_move_assignable_v<plane<T, Allocator>>)
+    {
+        std::swap(sz, other.sz);
+        std::swap(map, other.map);
+        elements = std::move(other.elements);
+        // Unless the storage was swapped, `other` kept its own.
+        if (other.elements.size() != other.map.storage_size())
+        {
+            other.sz  = sz;
+            other.map = map;
+        }
+        return *this;
+    }
+
+    constexpr explicit layout_plane(
+        const size_type sz, default_initialize_t,
+        const Allocator& a = Allocator()) requires std::default_initializable<T>
+      : sz{sz}, map{sz}, elements{map.storage_size(), default_initialize, a}
+    {
+    }
+
+    constexpr explicit layout_plane(
+        const size_type sz, value_initialize_t,
+        const Allocator& a = Allocator()) requires std::default_initializable<T>
+      : sz{sz}, map{sz}, elements{map.storage_size(), value_initialize, a}
+    {
+    }
+
+    constexpr layout_plane(
+        const std::initializer_list<std::initializer_list<T>> il2d,
+        const Allocator& a = Allocator()) requires
+        std::default_initializable<T> && std::copyable<T>
+      : layout_plane{
+            width_type{empty(il2d) ? 0 : il2d.begin()->size()} +
+                height{il2d.size()},
+            value_initialize, a}
+    {
+        assert(std::ranges::all_of(
+            il2d, lift::equal(sz.w()), std::ranges::size));
+        std::size_t y{0};
+        for (const std::initializer_list<T> row : il2d)
+        {
+            std::size_t x{0};
+            for (const T& e : row)
+                (*this)[abscissa{x++} + ordinate{y}] = e;
+            ++y;
+        }
+    }
+
+    // Constructs the elements from `r` in row-major order.
+    template <std::ranges::sized_range R>
+        requires std::ranges::input_range<R> && std::default_initializable<T> &&
+            std::assignable_from<T&, std::ranges::range_reference_t<R>>
+    constexpr layout_plane(
+        R&& r, const width_type w, const Allocator& a = Allocator())
+      : layout_plane{to_size(std::ranges::size(r), w), value_initialize, a}
+    {
+        std::size_t i{0};
+        for (auto&& e : r)
+            (*this)[to2d(i++, w)] = std::forward<decltype(e)>(e);
+    }
+
+    template <class Allocator2>
+        requires std::default_initializable<T> && std::copyable<T>
+    constexpr explicit operator plane<T, Allocator2>() const
+    {
+        plane<T, Allocator2> p{sz, default_initialize};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const point_type pt{abscissa{x} + ordinate{y}};
+                p[pt] = (*this)[pt];
+            }
+        return p;
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept
+    {
+        return elements.get_allocator();
+    }
+
+    [[nodiscard]] constexpr const mapping_type& mapping() const noexcept
+    {
+        return map;
+    }
+
+    [[nodiscard]] constexpr T& operator[](const point_type pt) noexcept
+    {
+        return const_cast<T&>(std::as_const(*this)[pt]);
+    }
+
+    [[nodiscard]] constexpr const T&
+    operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return to1d(elements)[map.to1d(pt)];
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // The storage, padding included, in storage order.
+    // `mapping().to2d(i)` is the point of the `i`th element.
+    [[nodiscard]] constexpr std::span<T> storage() noexcept
+    {
+        return to1d(elements);
+    }
+
+    [[nodiscard]] constexpr std::span<const T> storage() const noexcept
+    {
+        return to1d(elements);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const layout_plane& other) const
+        noexcept requires std::equality_comparable<T>
+    {
+        if (sz != other.sz)
+            return false;
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const point_type pt{abscissa{x} + ordinate{y}};
+                if (!((*this)[pt] == other[pt]))
+                    return false;
+            }
+        return true;
+    }
+};
+
+template <class T, class Allocator = std::allocator<T>>
+using morton_plane = layout_plane<T, layout_morton, Allocator>;
+
+template <class T, std::size_t Tile = 8, class Allocator = std::allocator<T>>
+using tiled_plane = layout_plane<T, layout_tiled<Tile>, Allocator>;
+
+namespace pmr
+{
+    template <class T, class Layout>
+    using layout_plane =
+        jge::layout_plane<T, Layout, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+} // namespace jge
+
+#endif // JGE_LAYOUT_PLANE_HPP
@@ -0,0 +1,235 @@
+#ifndef JGE_MAPPED_PLANE_HPP
+#define JGE_MAPPED_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <jge/cartesian.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace jge
+{
+// Identifies the element type of a mapped plane file.
+// Specialize it for other types to have their files checked.
+template <class T>
+inline constexpr std::uint64_t mapped_element_tag{0};
+
+template <class T>
+    requires std::is_arithmetic_v<T>
+inline constexpr std::uint64_t mapped_element_tag<T>{
+    (std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 'i' : 'u') << 8 |
+    sizeof(T)};
+
+namespace detail
+{
+    // The layout of a mapped plane file: this header, padded to
+    // `mapped_plane_header::size` bytes, followed by the elements in row-major
+    // order.
+    struct mapped_plane_header
+    {
+        static constexpr std::size_t size{64};
+        static constexpr char expected_magic[8]{'J', 'G', 'E', 'P',
+                                                'L', 'A', 'N', 'E'};
+
+        char magic[8];
+        std::uint64_t width;
+        std::uint64_t height;
+        std::uint64_t element_size;
+        std::uint64_t element_tag;
+    };
+
+    static_assert(sizeof(mapped_plane_header) <= mapped_plane_header::size);
+
+    template <class T>
+    constexpr mapped_plane_header
+    make_mapped_plane_header(const size2d<std::size_t> sz) noexcept
+    {
+        mapped_plane_header h{
+            {}, sz.w(), sz.h(), sizeof(T), mapped_element_tag<T>};
+        std::ranges::copy(mapped_plane_header::expected_magic, h.magic);
+        return h;
+    }
+
+} // namespace detail
+
+// A plane whose elements are those of a file mapped into memory, paged in on
+// demand. `mapped_plane<const T>` maps the file read-only.
+// `mapped_plane<T>` maps it copy-on-write: writes stay private to the
+// mapping, and never reach the file.
+template <class T>
+class [[nodiscard]] mapped_plane
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    using element_type = std::remove_const_t<T>;
+
+public:
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+private:
+    void* mapping{};
+    std::size_t mapping_size{};
+    T* data{};
+    size_type sz{};
+
+    [[noreturn]] static void throw_errno(const char* const what)
+    {
+        throw std::system_error{errno, std::generic_category(), what};
+    }
+
+public:
+    ~mapped_plane()
+    {
+        if (mapping != nullptr)
+            ::munmap(mapping, mapping_size);
+    }
+
+    mapped_plane() = default;
+
+    explicit mapped_plane(const std::filesystem::path& file)
+    {
+        const int fd{::open(file.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd == -1)
+            throw_errno("jge::mapped_plane: open");
+        struct fd_closer
+        {
+            int fd;
+
+            ~fd_closer()
+            {
+                ::close(fd);
+            }
+        } closer{fd};
+
+        struct ::stat st;
+        if (::fstat(fd, &st) == -1)
+            throw_errno("jge::mapped_plane: fstat");
+        const auto file_size{static_cast<std::size_t>(st.st_size)};
+        if (file_size < detail::mapped_plane_header::size)
+            throw std::runtime_error{"jge::mapped_plane: missing header"};
+
+        constexpr int protection{
+            std::is_const_v<T> ? PROT_READ : PROT_READ | PROT_WRITE};
+        void* const m{
+            ::mmap(nullptr, file_size, protection, MAP_PRIVATE, fd, 0)};
+        if (m == MAP_FAILED)
+            throw_errno("jge::mapped_plane: mmap");
+        // Unmaps `m` if the file is rejected.
+        struct unmapper
+        {
+            void* m;
+            std::size_t size;
+
+            ~unmapper()
+            {
+                if (m != nullptr)
+                    ::munmap(m, size);
+            }
+        } guard{m, file_size};
+
+        detail::mapped_plane_header h;
+        std::memcpy(&h, m, sizeof(h));
+        const auto expected{
+            detail::make_mapped_plane_header<element_type>({})};
+        if (!std::ranges::equal(h.magic, expected.magic) ||
+            h.element_size != expected.element_size ||
+            h.element_tag != expected.element_tag)
+            throw std::runtime_error{"jge::mapped_plane: wrong file type"};
+        std::size_t count;
+        if ((h.width == 0) != (h.height == 0) ||
+            __builtin_mul_overflow(h.width, h.height, &count) ||
+            (file_size - detail::mapped_plane_header::size) / sizeof(T) <
+                count)
+            throw std::runtime_error{"jge::mapped_plane: wrong file size"};
+        sz = {width_type{h.width}, height<std::size_t>{h.height}};
+        mapping      = std::exchange(guard.m, nullptr);
+        mapping_size = file_size;
+        data         = reinterpret_cast<T*>(
+            static_cast<std::byte*>(mapping) +
+            detail::mapped_plane_header::size);
+    }
+
+    mapped_plane(mapped_plane&& other) noexcept
+      : mapping{std::exchange(other.mapping, nullptr)},
+        mapping_size{std::exchange(other.mapping_size, 0)},
+        data{std::exchange(other.data, nullptr)},
+        sz{std::exchange(other.sz, {})}
+    {
+    }
+
+    mapped_plane& operator=(mapped_plane&& other) noexcept
+    {
+        std::swap(mapping, other.mapping);
+        std::swap(mapping_size, other.mapping_size);
+        std::swap(data, other.data);
+        std::swap(sz, other.sz);
+        return *this;
+    }
+
+    [[nodiscard]] T& operator[](const point_type pt) noexcept
+    {
+        assert(contains(sz, pt));
+        return data[to1d(pt, sz)];
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        return const_cast<mapped_plane&>(*this)[pt];
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    [[nodiscard]] friend std::span<T> to1d(mapped_plane& p) noexcept
+    {
+        return {p.data, to1d(p.sz)};
+    }
+
+    [[nodiscard]] friend std::span<const T>
+    to1d(const mapped_plane& p) noexcept
+    {
+        return to1d(const_cast<mapped_plane&>(p));
+    }
+};
+
+// Writes `p` to `file` in the format that `mapped_plane` maps.
+template <class P>
+void write_mapped_plane(const std::filesystem::path& file, const P& p)
+{
+    using T = std::ranges::range_value_t<decltype(to1d(p))>;
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    const auto h{detail::make_mapped_plane_header<T>(p.size())};
+    char header[detail::mapped_plane_header::size]{};
+    std::memcpy(header, &h, sizeof(h));
+
+    std::ofstream out{file, std::ios::binary | std::ios::trunc};
+    out.exceptions(std::ios::failbit | std::ios::badbit);
+    out.write(header, sizeof(header));
+    const auto elements{to1d(p)};
+    out.write(
+        reinterpret_cast<const char*>(elements.data()),
+        static_cast<std::streamsize>(elements.size_bytes()));
+}
+
+} // namespace jge
+
+#endif // JGE_MAPPED_PLANE_HPP
@@ -0,0 +1,219 @@
+#ifndef JGE_MDSPAN_HPP
+#define JGE_MDSPAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <version>
+#include <jge/cartesian.hpp>
+#include <jge/layout_plane.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+
+// Interoperability with `std::mdspan`, or with its reference implementation
+// as `std::experimental::mdspan`. Defines `JGE_HAS_MDSPAN` when either is
+// available, and nothing otherwise.
+#if defined(__cpp_lib_mdspan)
+#    include <mdspan>
+#    define JGE_HAS_MDSPAN 1
+#    define JGE_MDSPAN_NAMESPACE std
+#elif __has_include(<experimental/mdspan>)
+#    include <experimental/mdspan>
+#    define JGE_HAS_MDSPAN 1
+// Newer reference implementations name their namespace.
+#    ifdef MDSPAN_IMPL_STANDARD_NAMESPACE
+#        define JGE_MDSPAN_NAMESPACE MDSPAN_IMPL_STANDARD_NAMESPACE
+#    else
+#        define JGE_MDSPAN_NAMESPACE std::experimental
+#    endif
+#endif
+
+#ifdef JGE_HAS_MDSPAN
+
+namespace jge
+{
+namespace md = JGE_MDSPAN_NAMESPACE;
+
+// The extents of a plane, as (height, width), so that the mdspan element
+// `[y, x]` is the plane element at `abscissa{x} + ordinate{y}`.
+using plane_extents =
+    md::extents<std::size_t, md::dynamic_extent, md::dynamic_extent>;
+
+template <class T, class Layout = md::layout_right>
+using plane_mdspan = md::mdspan<T, plane_extents, Layout>;
+
+[[nodiscard]] constexpr plane_extents
+to_extents(const size2d<std::size_t> sz) noexcept
+{
+    return plane_extents{sz.h(), sz.w()};
+}
+
+// An mdspan layout policy for the storage order of a `layout_plane` with
+// the `jge` layout policy `Layout`, like `layout_tiled<8>`.
+template <class Layout>
+struct mdspan_layout
+{
+    template <class Extents>
+    class mapping
+    {
+        static_assert(Extents::rank() == 2);
+
+    public:
+        using extents_type = Extents;
+        using index_type   = typename Extents::index_type;
+        using size_type    = typename Extents::size_type;
+        using rank_type    = typename Extents::rank_type;
+        using layout_type  = mdspan_layout;
+
+    private:
+        Extents ext{};
+        typename Layout::mapping map{size2d<std::size_t>{}};
+
+        static constexpr size2d<std::size_t>
+        size_of(const Extents& e) noexcept
+        {
+            return width{static_cast<std::size_t>(e.extent(1))} +
+                   height{static_cast<std::size_t>(e.extent(0))};
+        }
+
+    public:
+        mapping() = default;
+
+        constexpr explicit mapping(const Extents& e) noexcept
+          : ext{e}, map{size_of(e)}
+        {
+        }
+
+        [[nodiscard]] constexpr const Extents& extents() const noexcept
+        {
+            return ext;
+        }
+
+        [[nodiscard]] constexpr index_type required_span_size() const noexcept
+        {
+            return static_cast<index_type>(jge::to1d(map.storage_size()));
+        }
+
+        template <std::integral I0, std::integral I1>
+        [[nodiscard]] constexpr index_type
+        operator()(const I0 y, const I1 x) const noexcept
+        {
+            return static_cast<index_type>(map.to1d(
+                abscissa{static_cast<std::size_t>(x)} +
+                ordinate{static_cast<std::size_t>(y)}));
+        }
+
+        static constexpr bool is_always_unique() noexcept
+        {
+            return true;
+        }
+
+        static constexpr bool is_always_exhaustive() noexcept
+        {
+            return false;
+        }
+
+        static constexpr bool is_always_strided() noexcept
+        {
+            return false;
+        }
+
+        static constexpr bool is_unique() noexcept
+        {
+            return true;
+        }
+
+        // Whether the storage has no padding.
+        [[nodiscard]] constexpr bool is_exhaustive() const noexcept
+        {
+            return map.storage_size() == size_of(ext);
+        }
+
+        static constexpr bool is_strided() noexcept
+        {
+            return false;
+        }
+
+        [[nodiscard]] friend constexpr bool
+        operator==(const mapping& l, const mapping& r) noexcept
+        {
+            return l.ext == r.ext;
+        }
+    };
+};
+
+// Views of `jge` planes as mdspans, without copying.
+
+template <class T, class Allocator>
+[[nodiscard]] constexpr plane_mdspan<T>
+to_mdspan(plane<T, Allocator>& p) noexcept
+{
+    return {to1d(p).data(), to_extents(p.size())};
+}
+
+template <class T, class Allocator>
+[[nodiscard]] constexpr plane_mdspan<const T>
+to_mdspan(const plane<T, Allocator>& p) noexcept
+{
+    return {to1d(p).data(), to_extents(p.size())};
+}
+
+template <class T>
+[[nodiscard]] constexpr plane_mdspan<T, md::layout_stride>
+to_mdspan(const plane_view<T> v) noexcept
+{
+    // Strides are positive, and rows do not overlap, even if the view is
+    // empty or a single row.
+    const std::array<std::size_t, 2> strides{
+        std::max({v.row_stride(), v.size().w(), std::size_t{1}}), 1};
+    return {
+        v.data(),
+        md::layout_stride::mapping<plane_extents>{
+            to_extents(v.size()), strides}};
+}
+
+template <class T, class Layout, class Allocator>
+[[nodiscard]] constexpr plane_mdspan<T, mdspan_layout<Layout>>
+to_mdspan(layout_plane<T, Layout, Allocator>& p) noexcept
+{
+    return {
+        p.storage().data(),
+        typename mdspan_layout<Layout>::template mapping<plane_extents>{
+            to_extents(p.size())}};
+}
+
+template <class T, class Layout, class Allocator>
+[[nodiscard]] constexpr plane_mdspan<const T, mdspan_layout<Layout>>
+to_mdspan(const layout_plane<T, Layout, Allocator>& p) noexcept
+{
+    return {
+        p.storage().data(),
+        typename mdspan_layout<Layout>::template mapping<plane_extents>{
+            to_extents(p.size())}};
+}
+
+// A view of the rank 2 mdspan `m`, without copying. Its extent 1 must have
+// a stride of 1.
+template <class T, class Extents, class Layout>
+    requires(Extents::rank() == 2) &&
+    (std::same_as<Layout, md::layout_right> ||
+     std::same_as<Layout, md::layout_stride>)
+[[nodiscard]] constexpr plane_view<T> to_plane_view(
+    const md::mdspan<T, Extents, Layout, md::default_accessor<T>>& m) noexcept
+{
+    assert(m.extent(1) <= 1 || m.stride(1) == 1);
+    const size2d sz{
+        width{static_cast<std::size_t>(m.extent(1))} +
+        height{static_cast<std::size_t>(m.extent(0))}};
+    const std::size_t stride{
+        m.extent(0) <= 1 ? sz.w() : static_cast<std::size_t>(m.stride(0))};
+    return {m.data_handle(), sz, stride};
+}
+
+} // namespace jge
+
+#endif // JGE_HAS_MDSPAN
+
+#endif // JGE_MDSPAN_HPP
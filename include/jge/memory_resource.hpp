@@ -0,0 +1,251 @@
+#ifndef JGE_MEMORY_RESOURCE_HPP
+#define JGE_MEMORY_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace jge
+{
+// Counters for tuning a memory resource.
+struct resource_stats
+{
+    // Allocations served from memory that the resource already held.
+    std::size_t hits{};
+    // Allocations that needed memory from the upstream resource.
+    std::size_t misses{};
+    // Bytes held from the upstream resource and available for reuse.
+    std::size_t bytes_retained{};
+
+    [[nodiscard]] friend constexpr bool
+    operator==(const resource_stats&, const resource_stats&) = default;
+};
+
+// A memory resource for allocations that live until the end of a frame.
+// Allocation bumps a pointer, deallocation does nothing, and `reset()`
+// reclaims everything at once while keeping the memory for the next frame.
+// Not thread-safe.
+class frame_arena : public std::pmr::memory_resource
+{
+    struct block
+    {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* upstream;
+    std::vector<block> blocks;
+    std::size_t next_block_size;
+    std::size_t current{0};
+    std::size_t offset{0};
+    resource_stats counters;
+
+    void* try_allocate(
+        const std::size_t bytes, const std::size_t alignment) noexcept
+    {
+        for (; current != blocks.size(); ++current, offset = 0)
+        {
+            void* p{blocks[current].data + offset};
+            std::size_t space{blocks[current].size - offset};
+            if (std::align(alignment, bytes, p, space) != nullptr)
+            {
+                offset = blocks[current].size - space + bytes;
+                return p;
+            }
+        }
+        return nullptr;
+    }
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment)
+        override
+    {
+        if (void* const p{try_allocate(bytes, alignment)})
+        {
+            ++counters.hits;
+            return p;
+        }
+        const std::size_t size{std::max(next_block_size, bytes + alignment)};
+        blocks.reserve(blocks.size() + 1);
+        blocks.push_back(
+            {static_cast<std::byte*>(
+                 upstream->allocate(size, alignof(std::max_align_t))),
+             size});
+        next_block_size = size * 2;
+        counters.bytes_retained += size;
+        ++counters.misses;
+        return try_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) noexcept override
+    {
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    explicit frame_arena(
+        const std::size_t initial_size = std::size_t{1} << 16,
+        std::pmr::memory_resource* const upstream =
+            std::pmr::get_default_resource())
+      : upstream{upstream},
+        next_block_size{std::max(initial_size, std::size_t{1})}
+    {
+    }
+
+    frame_arena(const frame_arena&) = delete;
+    frame_arena& operator=(const frame_arena&) = delete;
+
+    ~frame_arena() override
+    {
+        release();
+    }
+
+    // Reclaims all allocations. The memory is kept for reuse.
+    void reset() noexcept
+    {
+        current = 0;
+        offset  = 0;
+    }
+
+    // Reclaims all allocations, and returns the memory to the upstream
+    // resource.
+    void release() noexcept
+    {
+        for (const block b : blocks)
+            upstream->deallocate(b.data, b.size, alignof(std::max_align_t));
+        blocks.clear();
+        counters.bytes_retained = 0;
+        reset();
+    }
+
+    [[nodiscard]] const resource_stats& stats() const noexcept
+    {
+        return counters;
+    }
+
+    [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+    {
+        return upstream;
+    }
+};
+
+// A memory resource that keeps deallocated buffers, bucketed by size and
+// alignment, and hands them out again for allocations of the same size and
+// alignment. Planes of recurring sizes thus reuse each other's buffers.
+// At most `max_bytes_retained` bytes are kept; buffers beyond that are
+// returned to the upstream resource. Not thread-safe.
+class plane_pool : public std::pmr::memory_resource
+{
+    struct bucket_hash
+    {
+        std::size_t operator()(
+            const std::pair<std::size_t, std::size_t> key) const noexcept
+        {
+            return std::hash<std::size_t>{}(key.first ^ key.second << 48);
+        }
+    };
+
+    std::pmr::memory_resource* upstream;
+    std::size_t max_retained;
+    std::unordered_map<
+        std::pair<std::size_t, std::size_t>, std::vector<void*>, bucket_hash>
+        buckets;
+    resource_stats counters;
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment)
+        override
+    {
+        const auto it{buckets.find({bytes, alignment})};
+        if (it != buckets.end() && !it->second.empty())
+        {
+            void* const p{it->second.back()};
+            it->second.pop_back();
+            counters.bytes_retained -= bytes;
+            ++counters.hits;
+            return p;
+        }
+        void* const p{upstream->allocate(bytes, alignment)};
+        ++counters.misses;
+        return p;
+    }
+
+    void do_deallocate(
+        void* const p, const std::size_t bytes,
+        const std::size_t alignment) noexcept override
+    {
+        if (counters.bytes_retained + bytes <= max_retained)
+        {
+            try
+            {
+                buckets[{bytes, alignment}].push_back(p);
+                counters.bytes_retained += bytes;
+                return;
+            }
+            catch (...)
+            {
+            }
+        }
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    explicit plane_pool(
+        const std::size_t max_bytes_retained = std::size_t{64} << 20,
+        std::pmr::memory_resource* const upstream =
+            std::pmr::get_default_resource())
+      : upstream{upstream}, max_retained{max_bytes_retained}
+    {
+    }
+
+    plane_pool(const plane_pool&) = delete;
+    plane_pool& operator=(const plane_pool&) = delete;
+
+    ~plane_pool() override
+    {
+        release();
+    }
+
+    // Returns the retained buffers to the upstream resource.
+    void release() noexcept
+    {
+        for (auto& [key, ptrs] : buckets)
+            for (void* const p : ptrs)
+                upstream->deallocate(p, key.first, key.second);
+        buckets.clear();
+        counters.bytes_retained = 0;
+    }
+
+    [[nodiscard]] const resource_stats& stats() const noexcept
+    {
+        return counters;
+    }
+
+    [[nodiscard]] std::size_t max_bytes_retained() const noexcept
+    {
+        return max_retained;
+    }
+
+    [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+    {
+        return upstream;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_MEMORY_RESOURCE_HPP
@@ -0,0 +1,157 @@
+#ifndef JGE_MIP_PYRAMID_HPP
+#define JGE_MIP_PYRAMID_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/par.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/resample.hpp>
+#include <jge/thread_pool.hpp>
+
+namespace jge
+{
+namespace detail
+{
+    // Assigns to each element of `to` the average of the 2x2 elements of
+    // `from` it covers, where `from` is twice the size of `to`. Each row
+    // pair is first summed into a row of channels, so that both loops
+    // vectorize.
+    template <class T>
+    void halve(
+        const plane_view<const T> from, const plane_view<T> to,
+        thread_pool& pool)
+    {
+        using ch = channels<T>;
+        using C  = typename ch::type;
+        // Wide enough for the sum of four channels. Channels wider than 16
+        // bits are summed in floating point, as is their average.
+        using S = std::conditional_t<
+            std::is_unsigned_v<C> && sizeof(C) == 1, std::uint16_t,
+            std::conditional_t<
+                (sizeof(C) <= 2), decltype(C{} + C{}), filter_t<T>>>;
+        constexpr std::size_t n{ch::count};
+        assert(from.size().w() == 2 * to.size().w());
+        assert(from.size().h() == 2 * to.size().h());
+        par::detail::for_each_band(
+            pool, {pool, to.size(), 4 * sizeof(T)},
+            [&](std::size_t, const std::size_t first, const std::size_t last) {
+                // Locals, as stores of byte channels may alias anything else.
+                const std::size_t w{to.size().w()};
+                std::vector<S> row_sums(2 * w * n);
+                S* const sums{row_sums.data()};
+                for (std::size_t y{first}; y != last; ++y)
+                {
+                    const T* const a{from.row(2 * y).data()};
+                    const T* const b{from.row(2 * y + 1).data()};
+                    for (std::size_t x{0}; x != 2 * w; ++x)
+                        for (std::size_t c{0}; c != n; ++c)
+                            sums[x * n + c] =
+                                static_cast<S>(ch::get(a[x], c)) +
+                                static_cast<S>(ch::get(b[x], c));
+                    T* const out{to.row(y).data()};
+                    for (std::size_t x{0}; x != w; ++x)
+                        for (std::size_t c{0}; c != n; ++c)
+                        {
+                            const S sum{static_cast<S>(
+                                sums[2 * x * n + c] +
+                                sums[(2 * x + 1) * n + c])};
+                            if constexpr (
+                                std::is_unsigned_v<C> && std::is_integral_v<S>)
+                                ch::get(out[x], c) = static_cast<C>(
+                                    (sum + 2) / 4);
+                            else
+                                ch::get(out[x], c) = to_channel<C>(
+                                    static_cast<filter_t<T>>(sum) / 4);
+                        }
+                }
+            });
+    }
+
+} // namespace detail
+
+// The levels of detail of a plane, from the plane itself to a single
+// element, each half the width and height of the previous one, rounded
+// down but at least 1. Each level is the box filtered previous level.
+template <class T>
+    requires detail::filterable<T>
+class [[nodiscard]] mip_pyramid
+{
+public:
+    using value_type = T;
+    using level_type = plane<T>;
+    using size_type  = size2d<std::size_t>;
+
+private:
+    std::vector<level_type> levels;
+
+public:
+    mip_pyramid() = default;
+
+    // Builds every level from `base`, which becomes level 0.
+    explicit mip_pyramid(
+        level_type base, thread_pool& pool = default_thread_pool())
+    {
+        size_type sz{base.size()};
+        std::size_t count{1};
+        for (std::size_t side{std::max(sz.w(), sz.h())}; side > 1; side /= 2)
+            ++count;
+        levels.reserve(to1d(sz) == 0 ? 1 : count);
+        levels.push_back(std::move(base));
+        for (std::size_t i{1}; i < count; ++i)
+        {
+            const level_type& from{levels.back()};
+            const size_type half{
+                width{std::max(sz.w() / 2, std::size_t{1})} +
+                height{std::max(sz.h() / 2, std::size_t{1})}};
+            level_type to{half, for_overwrite};
+            if (sz.w() == 2 * half.w() && sz.h() == 2 * half.h())
+                detail::halve<T>(from, to, pool);
+            else
+                resample(from, to, resample_filter::box, pool);
+            levels.push_back(std::move(to));
+            sz = half;
+        }
+    }
+
+    // The number of levels.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return levels.size();
+    }
+
+    [[nodiscard]] const level_type&
+    operator[](const std::size_t level) const noexcept
+    {
+        assert(level < levels.size());
+        return levels[level];
+    }
+
+    [[nodiscard]] std::span<const level_type> all() const noexcept
+    {
+        return levels;
+    }
+
+    // The first level no larger than `sz` in width and height, or the last
+    // level if there is none.
+    [[nodiscard]] const level_type&
+    level_for(const size_type sz) const noexcept
+    {
+        assert(!levels.empty());
+        const auto it{std::ranges::find_if(levels, [&](const level_type& l) {
+            return l.size().w() <= sz.w() && l.size().h() <= sz.h();
+        })};
+        return it == levels.end() ? levels.back() : *it;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_MIP_PYRAMID_HPP
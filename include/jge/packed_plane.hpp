@@ -0,0 +1,298 @@
+#ifndef JGE_PACKED_PLANE_HPP
+#define JGE_PACKED_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// A plane of `Bits`-bit indices into a palette of at most `2^Bits` distinct
+// elements. Rows start on 8-byte boundaries.
+// The bulk row operations work a byte at a time, in loops that compilers
+// vectorize.
+template <std::size_t Bits, class T = std::size_t>
+    requires(Bits == 1 || Bits == 2 || Bits == 4 || Bits == 8) &&
+    std::copyable<T> && std::equality_comparable<T>
+class [[nodiscard]] packed_plane
+{
+public:
+    using value_type = T;
+    using index_type = std::uint8_t;
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+    static constexpr std::size_t bits{Bits};
+    static constexpr std::size_t palette_capacity{std::size_t{1} << Bits};
+
+private:
+    static constexpr std::size_t per_byte{8 / Bits};
+    static constexpr unsigned mask{(1U << Bits) - 1};
+    static constexpr std::size_t row_alignment{8};
+
+    size_type sz{};
+    std::size_t row_bytes{};
+    std::vector<std::uint8_t> bytes;
+    std::vector<T> colors;
+
+    static constexpr std::size_t bytes_for(const width_type w) noexcept
+    {
+        const std::size_t n{(w() + per_byte - 1) / per_byte};
+        return (n + row_alignment - 1) / row_alignment * row_alignment;
+    }
+
+    std::span<std::uint8_t> row_storage(const std::size_t y) noexcept
+    {
+        assert(y < sz.h());
+        return std::span{bytes}.subspan(y * row_bytes, row_bytes);
+    }
+
+    std::span<const std::uint8_t>
+    row_storage(const std::size_t y) const noexcept
+    {
+        return const_cast<packed_plane&>(*this).row_storage(y);
+    }
+
+    // Calls `f(x, index)` for each element of row `y`, in order.
+    template <class F>
+    void for_each_index(const std::size_t y, F f) const
+    {
+        const std::uint8_t* const row{row_storage(y).data()};
+        const std::size_t full{sz.w() / per_byte};
+        for (std::size_t i{0}; i != full; ++i)
+        {
+            const unsigned b{row[i]};
+            for (std::size_t j{0}; j != per_byte; ++j)
+                f(i * per_byte + j,
+                  static_cast<index_type>(b >> j * Bits & mask));
+        }
+        for (std::size_t x{full * per_byte}; x != sz.w(); ++x)
+            f(x, static_cast<index_type>(
+                     row[full] >> (x - full * per_byte) * Bits & mask));
+    }
+
+    // Sets row `y` to the indices `index(x)`, obtained in order.
+    template <class F>
+    void assign_indices(const std::size_t y, F index)
+    {
+        std::uint8_t* const row{row_storage(y).data()};
+        const std::size_t full{sz.w() / per_byte};
+        for (std::size_t i{0}; i != full; ++i)
+        {
+            unsigned b{0};
+            for (std::size_t j{0}; j != per_byte; ++j)
+                b |= unsigned{index(i * per_byte + j)} << j * Bits;
+            row[i] = static_cast<std::uint8_t>(b);
+        }
+        if (full * per_byte == sz.w())
+            return;
+        unsigned b{0};
+        for (std::size_t x{full * per_byte}; x != sz.w(); ++x)
+            b |= unsigned{index(x)} << (x - full * per_byte) * Bits;
+        row[full] = static_cast<std::uint8_t>(b);
+    }
+
+public:
+    // A proxy for an element, which assigns through the palette.
+    class reference
+    {
+        packed_plane* p;
+        point_type pt;
+
+        friend packed_plane;
+
+        constexpr reference(packed_plane& p, const point_type pt) noexcept
+          : p{&p}, pt{pt}
+        {
+        }
+
+    public:
+        reference(const reference&) = default;
+
+        operator const T&() const noexcept
+        {
+            return std::as_const(*p)[pt];
+        }
+
+        const reference& operator=(const T& v) const
+        {
+            p->set_index(pt, p->palette_index(v));
+            return *this;
+        }
+
+        const reference& operator=(const reference& r) const
+        {
+            return *this = static_cast<const T&>(r);
+        }
+
+        [[nodiscard]] friend bool
+        operator==(const reference& l, const T& r) noexcept
+        {
+            return static_cast<const T&>(l) == r;
+        }
+    };
+
+    packed_plane() = default;
+
+    // Constructs a plane of `sz` with every index 0, and the given palette.
+    explicit packed_plane(const size_type sz, std::vector<T> palette = {T()})
+      : sz{sz},
+        row_bytes{bytes_for(sz.w)},
+        bytes(row_bytes * sz.h()),
+        colors{std::move(palette)}
+    {
+        assert(!colors.empty() && colors.size() <= palette_capacity);
+    }
+
+    // Packs the elements of `p`.
+    // Throws `std::length_error` if they do not fit in a palette.
+    template <class Allocator>
+    explicit packed_plane(const plane<T, Allocator>& p)
+      : sz{p.size()},
+        row_bytes{bytes_for(sz.w)},
+        bytes(row_bytes * sz.h())
+    {
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            pack_row(y, to1d(p).subspan(y * sz.w(), sz.w()));
+    }
+
+    packed_plane(const std::initializer_list<std::initializer_list<T>> il2d)
+      : packed_plane{plane<T>{il2d}}
+    {
+    }
+
+    template <class Allocator>
+        requires std::default_initializable<T>
+    explicit operator plane<T, Allocator>() const
+    {
+        plane<T, Allocator> p{sz, default_initialize};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            unpack_row(y, to1d(p).subspan(y * sz.w(), sz.w()));
+        return p;
+    }
+
+    [[nodiscard]] reference operator[](const point_type pt) noexcept
+    {
+        return {*this, pt};
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        return colors[index(pt)];
+    }
+
+    [[nodiscard]] index_type index(const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        const unsigned b{row_storage(pt.y())[pt.x() / per_byte]};
+        return static_cast<index_type>(b >> pt.x() % per_byte * Bits & mask);
+    }
+
+    void set_index(const point_type pt, const index_type i) noexcept
+    {
+        assert(contains(sz, pt));
+        assert(i < colors.size());
+        std::uint8_t& b{row_storage(pt.y())[pt.x() / per_byte]};
+        const std::size_t shift{pt.x() % per_byte * Bits};
+        b = static_cast<std::uint8_t>((b & ~(mask << shift)) | i << shift);
+    }
+
+    [[nodiscard]] std::span<const T> palette() const noexcept
+    {
+        return colors;
+    }
+
+    // The index of `v` in the palette, which is added if missing.
+    // Throws `std::length_error` if the palette is full.
+    index_type palette_index(const T& v)
+    {
+        const auto it{std::ranges::find(colors, v)};
+        if (it != colors.end())
+            return static_cast<index_type>(it - colors.begin());
+        if (colors.size() == palette_capacity)
+            throw std::length_error{"jge::packed_plane: palette is full"};
+        colors.push_back(v);
+        return static_cast<index_type>(colors.size() - 1);
+    }
+
+    void unpack_row_indices(
+        const std::size_t y, const std::span<index_type> out) const noexcept
+    {
+        assert(out.size() == sz.w());
+        for_each_index(y, [out](const std::size_t x, const index_type i) {
+            out[x] = i;
+        });
+    }
+
+    void unpack_row(const std::size_t y, const std::span<T> out) const
+    {
+        assert(out.size() == sz.w());
+        for_each_index(y, [&](const std::size_t x, const index_type i) {
+            out[x] = colors[i];
+        });
+    }
+
+    void pack_row_indices(
+        const std::size_t y, const std::span<const index_type> in) noexcept
+    {
+        assert(in.size() == sz.w());
+        assert(std::ranges::all_of(
+            in, [&](const index_type i) { return i < colors.size(); }));
+        assign_indices(y, [in](const std::size_t x) { return in[x]; });
+    }
+
+    // Packs `in` into row `y`, adding its elements to the palette as needed.
+    // Throws `std::length_error` if the palette is full.
+    void pack_row(const std::size_t y, const std::span<const T> in)
+    {
+        assert(in.size() == sz.w());
+        // Tile rows are mostly runs, so remember the last lookup.
+        std::size_t last{colors.size()};
+        assign_indices(y, [&](const std::size_t x) {
+            if (last == colors.size() || !(colors[last] == in[x]))
+                last = palette_index(in[x]);
+            return static_cast<index_type>(last);
+        });
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // The packed storage, in bytes.
+    [[nodiscard]] std::size_t storage_bytes() const noexcept
+    {
+        return bytes.size();
+    }
+
+    [[nodiscard]] bool operator==(const packed_plane& other) const noexcept
+    {
+        if (sz != other.sz)
+            return false;
+        if (colors == other.colors)
+            return bytes == other.bytes;
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const point_type pt{abscissa{x} + ordinate{y}};
+                if (!((*this)[pt] == other[pt]))
+                    return false;
+            }
+        return true;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_PACKED_PLANE_HPP
@@ -0,0 +1,213 @@
+#ifndef JGE_PAR_HPP
+#define JGE_PAR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/thread_pool.hpp>
+
+// Parallel algorithms over planes and plane views. Each splits the plane
+// into bands of rows, which the tasks of a `thread_pool` process row by
+// row. Callbacks are called concurrently, and receive the point of the
+// element within the plane or view along with the element.
+
+namespace jge::par
+{
+namespace detail
+{
+    // The bands of rows of a plane of size `sz`, about `per_thread` for
+    // each thread of the pool to balance the load, but of at least
+    // `min_band_bytes` so that each task amortizes its scheduling.
+    struct row_bands
+    {
+        static constexpr std::size_t min_band_bytes{1 << 16};
+        static constexpr std::size_t per_thread{4};
+
+        std::size_t count{};
+        std::size_t rows{};
+        std::size_t remainder{};
+
+        row_bands(
+            const thread_pool& pool, const size2d<std::size_t> sz,
+            const std::size_t element_size) noexcept
+        {
+            if (to1d(sz) == 0)
+                return;
+            const std::size_t row_bytes{sz.w() * element_size};
+            const std::size_t min_rows{
+                std::max(min_band_bytes / row_bytes, std::size_t{1})};
+            count = std::clamp(
+                sz.h() / min_rows, std::size_t{1}, pool.size() * per_thread);
+            rows      = sz.h() / count;
+            remainder = sz.h() % count;
+        }
+
+        // The first row of band `i`.
+        [[nodiscard]] std::size_t first(const std::size_t i) const noexcept
+        {
+            return i * rows + std::min(i, remainder);
+        }
+    };
+
+    // Calls `f(i, first, last)` for each band `i` of rows [first, last).
+    template <class F>
+    void for_each_band(
+        thread_pool& pool, const row_bands& bands, const F& f)
+    {
+        pool.run(bands.count, [&](const std::size_t i) {
+            f(i, bands.first(i), bands.first(i + 1));
+        });
+    }
+
+} // namespace detail
+
+// Calls `f(pt, e)` for each element `e` of `p` at `pt`.
+template <jge::detail::viewable_plane P, class F>
+void for_each_point(P&& p, const F f, thread_pool& pool = default_thread_pool())
+{
+    const plane_view v{std::forward<P>(p)};
+    using T = typename decltype(v)::element_type;
+    detail::for_each_band(
+        pool, {pool, v.size(), sizeof(T)},
+        [&](std::size_t, const std::size_t first, const std::size_t last) {
+            for (std::size_t y{first}; y != last; ++y)
+            {
+                const std::span<T> row{v.row(y)};
+                for (std::size_t x{0}; x != row.size(); ++x)
+                    f(abscissa{x} + ordinate{y}, row[x]);
+            }
+        });
+}
+
+// Assigns `f(pt, e)` to the element of `to` at `pt`, for each element `e`
+// of `from` at `pt`. Both are of the same size.
+template <
+    jge::detail::viewable_plane From, jge::detail::viewable_plane To,
+    class F>
+void transform(
+    From&& from, To&& to, const F f, thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    using T = typename decltype(src)::element_type;
+    using U = typename decltype(dst)::element_type;
+    assert(src.size() == dst.size());
+    detail::for_each_band(
+        pool, {pool, src.size(), std::max(sizeof(T), sizeof(U))},
+        [&](std::size_t, const std::size_t first, const std::size_t last) {
+            for (std::size_t y{first}; y != last; ++y)
+            {
+                const std::span<T> in{src.row(y)};
+                const std::span<U> out{dst.row(y)};
+                for (std::size_t x{0}; x != in.size(); ++x)
+                    out[x] = f(abscissa{x} + ordinate{y}, in[x]);
+            }
+        });
+}
+
+// The elements of `p` and `init` combined with `op`, like `std::reduce`.
+// `op` is associative and commutative, and takes a `T` and an element or
+// two `T`s.
+template <jge::detail::viewable_plane P, class T, class BinaryOp>
+[[nodiscard]] T reduce(
+    P&& p, T init, const BinaryOp op, thread_pool& pool = default_thread_pool())
+{
+    const plane_view v{std::forward<P>(p)};
+    using E = typename decltype(v)::element_type;
+    const detail::row_bands bands{pool, v.size(), sizeof(E)};
+    std::vector<std::optional<T>> partials(bands.count);
+    detail::for_each_band(
+        pool, bands,
+        [&](const std::size_t i, const std::size_t first,
+            const std::size_t last) {
+            const std::span<E> front{v.row(first)};
+            T partial(front[0]);
+            for (std::size_t x{1}; x != front.size(); ++x)
+                partial = op(std::move(partial), front[x]);
+            for (std::size_t y{first + 1}; y != last; ++y)
+                for (E& e : v.row(y))
+                    partial = op(std::move(partial), e);
+            partials[i].emplace(std::move(partial));
+        });
+    for (std::optional<T>& partial : partials)
+        init = op(std::move(init), std::move(*partial));
+    return init;
+}
+
+// The number of elements `e` of `p` at `pt` for which `pred(pt, e)`.
+template <jge::detail::viewable_plane P, class Pred>
+[[nodiscard]] std::size_t
+count_if(P&& p, const Pred pred, thread_pool& pool = default_thread_pool())
+{
+    const plane_view v{std::forward<P>(p)};
+    using T = typename decltype(v)::element_type;
+    const detail::row_bands bands{pool, v.size(), sizeof(T)};
+    std::vector<std::size_t> counts(bands.count);
+    detail::for_each_band(
+        pool, bands,
+        [&](const std::size_t i, const std::size_t first,
+            const std::size_t last) {
+            std::size_t count{0};
+            for (std::size_t y{first}; y != last; ++y)
+            {
+                const std::span<T> row{v.row(y)};
+                for (std::size_t x{0}; x != row.size(); ++x)
+                    if (pred(abscissa{x} + ordinate{y}, row[x]))
+                        ++count;
+            }
+            counts[i] = count;
+        });
+    std::size_t count{0};
+    for (const std::size_t c : counts)
+        count += c;
+    return count;
+}
+
+// The first point `pt`, in row-major order, of an element `e` of `p` for
+// which `pred(pt, e)`. Bands after a match stop early.
+template <jge::detail::viewable_plane P, class Pred>
+[[nodiscard]] std::optional<point2d<std::size_t>>
+find_if(P&& p, const Pred pred, thread_pool& pool = default_thread_pool())
+{
+    const plane_view v{std::forward<P>(p)};
+    using T = typename decltype(v)::element_type;
+    const detail::row_bands bands{pool, v.size(), sizeof(T)};
+    std::vector<std::optional<point2d<std::size_t>>> found(bands.count);
+    // The first row with a match found so far.
+    std::atomic<std::size_t> found_row{v.size().h()};
+    detail::for_each_band(
+        pool, bands,
+        [&](const std::size_t i, const std::size_t first,
+            const std::size_t last) {
+            for (std::size_t y{first}; y != last && y <= found_row; ++y)
+            {
+                const std::span<T> row{v.row(y)};
+                for (std::size_t x{0}; x != row.size(); ++x)
+                    if (pred(abscissa{x} + ordinate{y}, row[x]))
+                    {
+                        found[i] = abscissa{x} + ordinate{y};
+                        std::size_t r{found_row};
+                        while (y < r && !found_row.compare_exchange_weak(r, y))
+                        {
+                        }
+                        return;
+                    }
+            }
+        });
+    for (const std::optional<point2d<std::size_t>>& pt : found)
+        if (pt)
+            return pt;
+    return std::nullopt;
+}
+
+} // namespace jge::par
+
+#endif // JGE_PAR_HPP
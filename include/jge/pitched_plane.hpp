@@ -0,0 +1,334 @@
+#ifndef JGE_PITCHED_PLANE_HPP
+#define JGE_PITCHED_PLANE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/detail/memory.hpp>
+#include <jge/plane.hpp>
+#include <lift.hpp>
+
+namespace jge
+{
+// A plane whose rows each start on an `Alignment` byte boundary.
+// Rows are `row_pitch()` elements apart; the elements past a row's width are
+// padding, and are neither constructed nor compared. The pitch is a multiple
+// of the elements of a common multiple of `Alignment` and `sizeof(T)`, so
+// elements of any size, like 3-byte RGB pixels, can be pitched.
+template <
+    class T, std::size_t Alignment = 64, class Allocator = std::allocator<T>>
+class [[nodiscard]] pitched_plane
+{
+    static_assert(std::has_single_bit(Alignment));
+    static_assert(Alignment % alignof(T) == 0);
+
+    struct alignas(Alignment) block
+    {
+        std::byte bytes[Alignment];
+    };
+
+    using alloc_traits    = std::allocator_traits<Allocator>;
+    using block_allocator = typename alloc_traits::template rebind_alloc<block>;
+    using block_traits    = std::allocator_traits<block_allocator>;
+
+    static_assert(std::same_as<typename alloc_traits::value_type, T>);
+    static_assert(std::same_as<typename block_traits::pointer, block*>);
+
+public:
+    using allocator_type = Allocator;
+    using width_type     = width<std::size_t>;
+    using size_type      = size2d<width_type::rep>;
+    using point_type     = point2d<size_type::rep>;
+
+    static constexpr std::size_t row_alignment{Alignment};
+
+private:
+    // The fewest elements that span whole blocks.
+    static constexpr std::size_t block_elements{
+        std::lcm(Alignment, sizeof(T)) / sizeof(T)};
+
+    [[no_unique_address]] Allocator alloc{};
+    block* blocks{};
+    size_type sz{};
+    std::size_t pitch{};
+
+    static std::size_t pitch_for(const width_type w) noexcept
+    {
+        return (w() + block_elements - 1) / block_elements * block_elements;
+    }
+
+    std::size_t block_count() const noexcept
+    {
+        return pitch * sz.h() * sizeof(T) / Alignment;
+    }
+
+    T* first() const noexcept
+    {
+        return reinterpret_cast<T*>(blocks);
+    }
+
+    // Allocates storage for `new_sz` and constructs each row with
+    // `construct(row, y)`. Releases everything if `construct` throws.
+    void create(const size_type new_sz, auto construct)
+    {
+        assert(blocks == nullptr);
+        assert(new_sz == size_type{} || to1d(new_sz) != 0);
+        sz    = new_sz;
+        pitch = pitch_for(sz.w);
+        if (to1d(sz) == 0)
+            return;
+        block_allocator balloc{alloc};
+        blocks = block_traits::allocate(balloc, block_count());
+        std::size_t y{0};
+        try
+        {
+            for (; y != sz.h(); ++y)
+                construct(row(y), y);
+        }
+        catch (...)
+        {
+            while (y != 0)
+                detail::destroy(alloc, row(--y));
+            block_traits::deallocate(
+                balloc, std::exchange(blocks, nullptr), block_count());
+            sz    = {};
+            pitch = 0;
+            throw;
+        }
+    }
+
+    void destroy() noexcept
+    {
+        if (blocks == nullptr)
+            return;
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            detail::destroy(alloc, row(y));
+        block_allocator balloc{alloc};
+        block_traits::deallocate(
+            balloc, std::exchange(blocks, nullptr), block_count());
+    }
+
+    void swap_storage(pitched_plane& other) noexcept
+    {
+        std::swap(blocks, other.blocks);
+        std::swap(sz, other.sz);
+        std::swap(pitch, other.pitch);
+    }
+
+    template <class R>
+    void create_from(R&& r, const width_type w)
+    {
+        auto it{std::ranges::begin(r)};
+        create(
+            to_size(std::ranges::size(r), w), [&](const std::span<T> row, auto) {
+                it = detail::uninitialized_copy(
+                         alloc,
+                         std::ranges::subrange{
+                             std::move(it), std::ranges::end(r)},
+                         row)
+                         .in;
+            });
+    }
+
+public:
+    ~pitched_plane() requires std::destructible<T>
+    {
+        destroy();
+    }
+
+    pitched_plane() = default;
+
+    explicit pitched_plane(const Allocator& a) noexcept : alloc{a}
+    {
+    }
+
+    pitched_plane(const pitched_plane& other) requires std::copyable<T>
+      : pitched_plane{
+            other, alloc_traits::select_on_container_copy_construction(
+                       other.alloc)}
+    {
+    }
+
+    pitched_plane(const pitched_plane& other, const Allocator& a) requires
+        std::copyable<T> : alloc{a}
+    {
+        create(other.sz, [&](const std::span<T> row, const std::size_t y) {
+            detail::uninitialized_copy(alloc, other.row(y), row);
+        });
+    }
+
+    pitched_plane& operator=(const pitched_plane& other) requires std::copyable<T>
+    {
+        constexpr bool propagate{
+            alloc_traits::propagate_on_container_copy_assignment::value};
+        if (sz == other.sz && (!propagate || alloc == other.alloc))
+        {
+            for (std::size_t y{0}; y != sz.h(); ++y)
+                std::ranges::copy(other.row(y), row(y).begin());
+            return *this;
+        }
+        pitched_plane copy{other, propagate ? other.alloc : alloc};
+        destroy();
+        if constexpr (propagate)
+            alloc = other.alloc;
+        swap_storage(copy);
+        return *this;
+    }
+
+    pitched_plane(pitched_plane&& other) noexcept
+      : alloc{std::move(other.alloc)},
+        blocks{std::exchange(other.blocks, nullptr)},
+        sz{std::exchange(other.sz, {})},
+        pitch{std::exchange(other.pitch, 0)}
+    {
+    }
+
+    pitched_plane(pitched_plane&& other, const Allocator& a) : alloc{a}
+    {
+        if (alloc == other.alloc)
+            swap_storage(other);
+        else
+            create(other.sz, [&](const std::span<T> row, const std::size_t y) {
+                detail::uninitialized_copy(
+                    alloc,
+                    std::ranges::subrange{
+                        std::make_move_iterator(other.row(y).begin()),
+                        std::make_move_iterator(other.row(y).end())},
+                    row);
+            });
+    }
+
+    pitched_plane& operator=(pitched_plane&& other) noexcept(
+        (alloc_traits::propagate_on_container_move_assignment::value ||
+         alloc_traits::is_always_equal::value))
+    {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                          value)
+        {
+            using std::swap;
+            swap(alloc, other.alloc);
+            swap_storage(other);
+        }
+        else if (alloc == other.alloc)
+            swap_storage(other);
+        else
+        {
+            pitched_plane moved{std::move(other), alloc};
+            swap_storage(moved);
+        }
+        return *this;
+    }
+
+    explicit pitched_plane(
+        const size_type sz, default_initialize_t,
+        const Allocator& a = Allocator()) requires std::default_initializable<T>
+      : alloc{a}
+    {
+        create(sz, [&](const std::span<T> row, auto) {
+            detail::uninitialized_default_construct(alloc, row);
+        });
+    }
+
+    explicit pitched_plane(
+        const size_type sz, value_initialize_t,
+        const Allocator& a = Allocator()) requires std::default_initializable<T>
+      : alloc{a}
+    {
+        create(sz, [&](const std::span<T> row, auto) {
+            detail::uninitialized_value_construct(alloc, row);
+        });
+    }
+
+    pitched_plane(
+        const std::initializer_list<std::initializer_list<T>> il2d,
+        const Allocator& a = Allocator()) requires std::copyable<T>
+      : alloc{a}
+    {
+        const width_type w{empty(il2d) ? 0 : il2d.begin()->size()};
+        assert(std::ranges::all_of(il2d, lift::equal(w()), std::ranges::size));
+        const std::ranges::join_view il1d{il2d};
+        create_from(std::ranges::subrange{il1d, il2d.size() * w()}, w);
+    }
+
+    template <std::ranges::sized_range R>
+        requires std::ranges::input_range<R> &&
+            std::constructible_from<T, std::ranges::range_reference_t<R>>
+    pitched_plane(R&& r, const width_type w, const Allocator& a = Allocator())
+      : alloc{a}
+    {
+        create_from(std::forward<R>(r), w);
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return alloc;
+    }
+
+    [[nodiscard]] T& operator[](const point_type pt) noexcept
+    {
+        return const_cast<T&>(std::as_const(*this)[pt]);
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return first()[pt.y() * pitch + pt.x()];
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // Distance, in elements, between the starts of consecutive rows.
+    [[nodiscard]] std::size_t row_pitch() const noexcept
+    {
+        return pitch;
+    }
+
+    [[nodiscard]] std::span<T> row(const std::size_t y) noexcept
+    {
+        assert(y < sz.h());
+        return {first() + y * pitch, sz.w()};
+    }
+
+    [[nodiscard]] std::span<const T> row(const std::size_t y) const noexcept
+    {
+        return const_cast<pitched_plane&>(*this).row(y);
+    }
+
+    [[nodiscard]] bool operator==(const pitched_plane& other) const
+        noexcept requires std::equality_comparable<T>
+    {
+        if (sz != other.sz)
+            return false;
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            if (!std::ranges::equal(row(y), other.row(y)))
+                return false;
+        return true;
+    }
+};
+
+namespace pmr
+{
+    template <class T, std::size_t Alignment = 64>
+    using pitched_plane =
+        jge::pitched_plane<T, Alignment, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+} // namespace jge
+
+#endif // JGE_PITCHED_PLANE_HPP
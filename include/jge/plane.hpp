@@ -6,13 +6,16 @@
 #include <concepts>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <ranges>
 #include <span>
 #include <type_traits>
 #include <utility>
 #include <jge/cartesian.hpp>
 #include <jge/detail/memory.hpp>
+#include <jge/detail/parallel.hpp>
 #include <lift.hpp>
 
 namespace jge
@@ -24,6 +27,12 @@ struct [[nodiscard]] default_initialize_t
 
 inline constexpr default_initialize_t default_initialize{};
 
+// For elements that are about to be overwritten.
+// Leaves trivial elements uninitialized, like `default_initialize`.
+using for_overwrite_t = default_initialize_t;
+
+inline constexpr for_overwrite_t for_overwrite{};
+
 struct [[nodiscard]] value_initialize_t
 {
     explicit value_initialize_t() = default;
@@ -31,30 +40,158 @@ struct [[nodiscard]] value_initialize_t
 
 inline constexpr value_initialize_t value_initialize{};
 
-template <class T>
+// Like `value_initialize`, but spreads the initialization across threads by
+// row bands, so that each thread first touches the pages of its band.
+struct [[nodiscard]] parallel_value_initialize_t
+{
+    explicit parallel_value_initialize_t() = default;
+};
+
+inline constexpr parallel_value_initialize_t parallel_value_initialize{};
+
+// Where the existing elements of a plane stay when it is resized.
+enum class anchor
+{
+    top_left,
+    top,
+    top_right,
+    left,
+    center,
+    right,
+    bottom_left,
+    bottom,
+    bottom_right
+};
+
+template <class T, class Allocator = std::allocator<T>>
 class [[nodiscard]] plane
 {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::same_as<typename alloc_traits::value_type, T>);
+    static_assert(std::same_as<typename alloc_traits::pointer, T*>);
+
 public:
-    using width_type = width<std::size_t>;
-    using size_type  = size2d<width_type::rep>;
-    using point_type = point2d<size_type::rep>;
+    using allocator_type = Allocator;
+    using width_type     = width<std::size_t>;
+    using size_type      = size2d<width_type::rep>;
+    using point_type     = point2d<size_type::rep>;
 
 private:
+    [[no_unique_address]] Allocator alloc{};
     T* data{};
     size_type sz{};
+    std::size_t cap{};
+
+    // Allocates storage for `sz` and constructs its elements with `construct`.
+    // Releases the storage if `construct` throws.
+    constexpr void create(auto construct)
+    {
+        assert(data == nullptr);
+        if (to1d(sz) == 0)
+            return;
+        data = alloc_traits::allocate(alloc, to1d(sz));
+        try
+        {
+            construct(std::span{data, to1d(sz)});
+        }
+        catch (...)
+        {
+            alloc_traits::deallocate(
+                alloc, std::exchange(data, nullptr), to1d(sz));
+            throw;
+        }
+        cap = to1d(sz);
+    }
+
+    constexpr void destroy() noexcept
+    {
+        if (data == nullptr)
+            return;
+        detail::destroy(alloc, to1d(*this));
+        alloc_traits::deallocate(
+            alloc, std::exchange(data, nullptr), std::exchange(cap, 0));
+    }
+
+    constexpr void swap_storage(plane& other) noexcept
+    {
+        std::swap(data, other.data);
+        std::swap(sz, other.sz);
+        std::swap(cap, other.cap);
+    }
+
+    // Replaces the storage with one of capacity `new_cap` for `new_sz`,
+    // whose elements are constructed with `construct(new_data)`.
+    constexpr void reallocate(
+        const std::size_t new_cap, const size_type new_sz, auto construct)
+    {
+        assert(to1d(new_sz) <= new_cap);
+        T* const new_data{
+            new_cap == 0 ? nullptr : alloc_traits::allocate(alloc, new_cap)};
+        try
+        {
+            construct(std::span{new_data, to1d(new_sz)});
+        }
+        catch (...)
+        {
+            if (new_data != nullptr)
+                alloc_traits::deallocate(alloc, new_data, new_cap);
+            throw;
+        }
+        destroy();
+        data = new_data;
+        sz   = new_sz;
+        cap  = new_cap;
+    }
+
+    constexpr auto moved_elements() noexcept
+    {
+        return std::ranges::subrange{
+            std::make_move_iterator(to1d(*this).begin()),
+            std::make_move_iterator(to1d(*this).end())};
+    }
+
+    // Translation from the points of a plane of size `from` to those of a
+    // plane of size `to` that keeps them at anchor `a`.
+    static constexpr point2d<std::ptrdiff_t>
+    anchor_offset(const size_type from, const size_type to, const anchor a)
+    {
+        const auto offset = [](const std::size_t f, const std::size_t t,
+                               const int side) {
+            const auto diff{static_cast<std::ptrdiff_t>(t - f)};
+            return diff * side / 2;
+        };
+        const auto i{static_cast<int>(a)};
+        return {
+            abscissa{offset(from.w(), to.w(), i % 3)},
+            ordinate{offset(from.h(), to.h(), i / 3)}};
+    }
 
 public:
     constexpr ~plane() requires std::destructible<T>
     {
-        delete[] data;
+        destroy();
     }
 
     plane() = default;
 
+    constexpr explicit plane(const Allocator& a) noexcept : alloc{a}
+    {
+    }
+
     constexpr plane(const plane& other) noexcept(
-        (detail::default_allocator_is_nothrow &&
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : plane{
+            to1d(other), other.sz.w,
+            alloc_traits::select_on_container_copy_construction(other.alloc)}
+    {
+    }
+
+    constexpr plane(const plane& other, const Allocator& a) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
          std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
-      : plane{to1d(other), other.sz.w}
+      : plane{to1d(other), other.sz.w, a}
     {
     }
 
@@ -62,46 +199,116 @@ public:
         (std::is_nothrow_copy_constructible_v<plane> &&
          std::is_nothrow_copy_assignable_v<T>)) requires std::copyable<T>
     {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                          value)
+        {
+            if (alloc != other.alloc)
+            {
+                destroy();
+                sz = {};
+            }
+            alloc = other.alloc;
+        }
         assign(to1d(other), other.sz.w);
         return *this;
     }
 
     constexpr plane(plane&& other) noexcept
-      : data{std::exchange(other.data, nullptr)},
-        sz{std::exchange(other.sz, {})}
+      : alloc{std::move(other.alloc)},
+        data{std::exchange(other.data, nullptr)},
+        sz{std::exchange(other.sz, {})},
+        cap{std::exchange(other.cap, 0)}
     {
     }
 
-    constexpr plane& operator=(plane&& other) noexcept
+    constexpr plane(plane&& other, const Allocator& a) : alloc{a}
     {
-        std::swap(data, other.data);
-        std::swap(sz, other.sz);
+        if (alloc == other.alloc)
+            swap_storage(other);
+        else
+            assign(other.moved_elements(), other.sz.w);
+    }
+
+    constexpr plane& operator=(plane&& other) noexcept(
+        (alloc_traits::propagate_on_container_move_assignment::value ||
+         alloc_traits::is_always_equal::value))
+    {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                          value)
+        {
+            using std::swap;
+            swap(alloc, other.alloc);
+            swap_storage(other);
+        }
+        else if (alloc == other.alloc)
+            swap_storage(other);
+        else
+            assign(other.moved_elements(), other.sz.w);
         return *this;
     }
 
-    constexpr explicit plane(const size_type sz, default_initialize_t) noexcept(
-        (detail::default_allocator_is_nothrow &&
+    constexpr explicit plane(
+        const size_type sz, default_initialize_t,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
          std::is_nothrow_default_constructible_v<T>)) requires
         std::default_initializable<T>
-      : data{to1d(sz) == 0 ? nullptr : new T[to1d(sz)]}, sz{sz}
+      : alloc{a}, sz{sz}
     {
         assert(sz == size_type{} || to1d(sz) != 0);
+        create([&](const std::span<T> s) {
+            detail::uninitialized_default_construct(alloc, s);
+        });
     }
 
-    constexpr explicit plane(const size_type sz, value_initialize_t) noexcept(
-        (detail::default_allocator_is_nothrow &&
+    constexpr explicit plane(
+        const size_type sz, value_initialize_t,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
          std::is_nothrow_default_constructible_v<T>)) requires
         std::default_initializable<T>
-      : data{to1d(sz) == 0 ? nullptr : std::allocator<T>{}.allocate(to1d(sz))},
-        sz{sz}
+      : alloc{a}, sz{sz}
     {
         assert(sz == size_type{} || to1d(sz) != 0);
-        detail::uninitialized_value_construct(to1d(*this));
+        create([&](const std::span<T> s) {
+            detail::uninitialized_value_construct(alloc, s);
+        });
     }
 
-    constexpr plane(const std::initializer_list<std::initializer_list<T>> il2d) noexcept(
-        (detail::default_allocator_is_nothrow &&
+    // Serial during constant evaluation, and for planes smaller than a few
+    // pages per thread.
+    constexpr explicit plane(
+        const size_type sz, parallel_value_initialize_t,
+        const Allocator& a = Allocator()) requires
+        std::is_nothrow_default_constructible_v<T>
+      : alloc{a}, sz{sz}
+    {
+        assert(sz == size_type{} || to1d(sz) != 0);
+        create([&](const std::span<T> s) {
+            if (std::is_constant_evaluated())
+            {
+                detail::uninitialized_value_construct(alloc, s);
+                return;
+            }
+            constexpr std::size_t min_band_bytes{1 << 16};
+            const std::size_t row_bytes{
+                std::max(sz.w() * sizeof(T), std::size_t{1})};
+            detail::for_each_band(
+                sz.h(), (min_band_bytes + row_bytes - 1) / row_bytes,
+                [&](const std::size_t first, const std::size_t last) {
+                    detail::uninitialized_value_construct(
+                        alloc,
+                        s.subspan(first * sz.w(), (last - first) * sz.w()));
+                });
+        });
+    }
+
+    constexpr plane(
+        const std::initializer_list<std::initializer_list<T>> il2d,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
          std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : alloc{a}
     {
         *this = il2d;
     }
@@ -118,10 +325,12 @@ public:
         return *this;
     }
 
-    constexpr plane(const std::initializer_list<T> il, const width_type w) noexcept(
-        (detail::default_allocator_is_nothrow &&
+    constexpr plane(
+        const std::initializer_list<T> il, const width_type w,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
          std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
-      : plane{std::span{il}, w}
+      : plane{std::span{il}, w, a}
     {
     }
 
@@ -136,26 +345,158 @@ public:
     template <std::ranges::sized_range R>
         requires std::ranges::input_range<R> &&
             std::constructible_from<T, std::ranges::range_reference_t<R>>
-    constexpr plane(R&& r, const width_type w)
-      : data{w() == 0 ? nullptr : std::allocator<T>{}.allocate(std::ranges::size(r))},
-        sz{to_size(std::ranges::size(r), w)}
+    constexpr plane(R&& r, const width_type w, const Allocator& a = Allocator())
+      : alloc{a}, sz{to_size(std::ranges::size(r), w)}
     {
-        detail::uninitialized_copy(std::forward<R>(r), to1d(*this));
+        create([&](const std::span<T> s) {
+            detail::uninitialized_copy(alloc, std::forward<R>(r), s);
+        });
     }
 
     template <class R>
-        requires std::constructible_from<plane, R, width_type>
+        requires std::constructible_from<plane, R, width_type, Allocator>
     constexpr void assign(R&& r, const width_type w)
     {
-        if (to1d(sz) != std::ranges::size(r))
+        const std::size_t n{std::ranges::size(r)};
+        if (cap < n)
         {
-            delete[] data;
-            *this = plane{std::forward<R>(r), w};
+            *this = plane{std::forward<R>(r), w, alloc};
             return;
         }
 
-        sz = to_size(std::ranges::size(r), w);
-        std::ranges::copy(std::forward<R>(r), data);
+        const size_type new_sz{to_size(n, w)};
+        const std::size_t old_n{to1d(sz)};
+        auto [in, out] = std::ranges::copy_n(
+            std::ranges::begin(r), std::min(old_n, n), data);
+        if (old_n < n)
+            detail::uninitialized_copy(
+                alloc,
+                std::ranges::subrange{std::move(in), std::ranges::end(r)},
+                std::span{out, n - old_n});
+        else
+            detail::destroy(alloc, std::span{out, old_n - n});
+        sz = new_sz;
+    }
+
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept
+    {
+        return cap;
+    }
+
+    // Makes room for `n` elements, moving the current ones.
+    constexpr void reserve(const std::size_t n) requires std::movable<T>
+    {
+        if (n <= cap)
+            return;
+        reallocate(n, sz, [&](const std::span<T> s) {
+            detail::uninitialized_copy(alloc, moved_elements(), s);
+        });
+    }
+
+    constexpr void shrink_to_fit() requires std::movable<T>
+    {
+        if (to1d(sz) == cap)
+            return;
+        reallocate(to1d(sz), sz, [&](const std::span<T> s) {
+            detail::uninitialized_copy(alloc, moved_elements(), s);
+        });
+    }
+
+    // Changes the size to `new_sz`. Elements that remain within the plane
+    // when its old bounds are placed at anchor `a` of the new bounds keep
+    // their value; the rest are cropped or value-initialized.
+    // The storage is reused when the capacity suffices.
+    constexpr void
+    resize(const size_type new_sz, const anchor a = anchor::top_left) requires
+        std::default_initializable<T> && std::movable<T>
+    {
+        assert(new_sz == size_type{} || to1d(new_sz) != 0);
+        using diff_t = std::ptrdiff_t;
+        const auto ow{static_cast<diff_t>(sz.w())};
+        const auto oh{static_cast<diff_t>(sz.h())};
+        const auto nw{static_cast<diff_t>(new_sz.w())};
+        const auto nh{static_cast<diff_t>(new_sz.h())};
+        const auto [dx, dy]{anchor_offset(sz, new_sz, a)};
+        // The kept elements, in the old plane's coordinates.
+        const diff_t x0{std::max(diff_t{0}, -dx())};
+        const diff_t x1{std::min(ow, nw - dx())};
+        const diff_t y0{std::max(diff_t{0}, -dy())};
+        const diff_t y1{std::min(oh, nh - dy())};
+        const diff_t kept_w{std::max(diff_t{0}, x1 - x0)};
+        const bool keeps{kept_w != 0 && y0 < y1};
+        const auto is_kept = [&](const diff_t x, const diff_t y) {
+            return keeps && x0 <= x - dx() && x - dx() < x1 && y0 <= y - dy() &&
+                   y - dy() < y1;
+        };
+
+        const auto old_n{static_cast<std::size_t>(ow * oh)};
+        const auto new_n{static_cast<std::size_t>(nw * nh)};
+        if (cap < new_n)
+        {
+            const auto construct = [&](const std::span<T> s) {
+                std::size_t i{0};
+                try
+                {
+                    for (; i != new_n; ++i)
+                    {
+                        const auto x{static_cast<diff_t>(i) % nw};
+                        const auto y{static_cast<diff_t>(i) / nw};
+                        if (is_kept(x, y))
+                            alloc_traits::construct(
+                                alloc, &s[i],
+                                std::move(data[(y - dy()) * ow + x - dx()]));
+                        else
+                            alloc_traits::construct(alloc, &s[i]);
+                    }
+                }
+                catch (...)
+                {
+                    detail::destroy(alloc, s.first(i));
+                    throw;
+                }
+            };
+            reallocate(std::max(new_n, 2 * cap), new_sz, construct);
+            return;
+        }
+
+        if (old_n < new_n)
+            detail::uninitialized_value_construct(
+                alloc, std::span{data + old_n, new_n - old_n});
+        // Move each kept row to its new place. Kept elements keep their
+        // relative order, so moving the rows that go backward in ascending
+        // order, and then those that go forward in descending order, never
+        // overwrites a kept element before it is moved.
+        const auto move_row = [&](const diff_t y) {
+            T* const src{data + y * ow + x0};
+            T* const dst{data + (y + dy()) * nw + x0 + dx()};
+            if (dst < src)
+                std::ranges::move(src, src + kept_w, dst);
+            else if (src < dst)
+                std::ranges::move_backward(src, src + kept_w, dst + kept_w);
+        };
+        const auto goes_forward = [&](const diff_t y) {
+            return y * ow + x0 < (y + dy()) * nw + x0 + dx();
+        };
+        if (keeps)
+        {
+            for (diff_t y{y0}; y != y1; ++y)
+                if (!goes_forward(y))
+                    move_row(y);
+            for (diff_t y{y1}; y != y0; --y)
+                if (goes_forward(y - 1))
+                    move_row(y - 1);
+        }
+        for (diff_t i{0}; i != static_cast<diff_t>(new_n); ++i)
+            if (!is_kept(i % nw, i / nw))
+                data[i] = T();
+        if (new_n < old_n)
+            detail::destroy(alloc, std::span{data + new_n, old_n - new_n});
+        sz = new_sz;
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept
+    {
+        return alloc;
     }
 
     [[nodiscard]] constexpr T& operator[](const point_type pt) noexcept
@@ -199,6 +540,18 @@ template <class R>
 plane(R&&, typename plane<std::ranges::range_value_t<R>>::width_type)
     -> plane<std::ranges::range_value_t<R>>;
 
+template <class R, class Allocator>
+plane(
+    R&&, typename plane<std::ranges::range_value_t<R>>::width_type,
+    const Allocator&) -> plane<std::ranges::range_value_t<R>, Allocator>;
+
+namespace pmr
+{
+    template <class T>
+    using plane = jge::plane<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace jge
 
 #endif // JGE_PLANE_HPP
@@ -0,0 +1,184 @@
+#ifndef JGE_PLANE_VIEW_HPP
+#define JGE_PLANE_VIEW_HPP
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// A non-owning view of a plane of elements whose rows are `row_stride()`
+// elements apart, like a subplane of a `plane` or a foreign image buffer.
+// Copying a view is cheap and never copies its elements.
+template <class T>
+class [[nodiscard]] plane_view
+{
+public:
+    using element_type  = T;
+    using value_type    = std::remove_cv_t<T>;
+    using width_type    = width<std::size_t>;
+    using size_type     = size2d<width_type::rep>;
+    using point_type    = point2d<size_type::rep>;
+    using subplane_type = subplane<size_type::rep>;
+
+private:
+    T* first{};
+    size_type sz{};
+    std::size_t stride{};
+
+public:
+    plane_view() = default;
+
+    // Views the `sz` elements at `first`, with rows `row_stride` elements
+    // apart.
+    constexpr plane_view(
+        T* const first, const size_type sz,
+        const std::size_t row_stride) noexcept
+      : first{first}, sz{sz}, stride{row_stride}
+    {
+        assert(row_stride >= sz.w() || sz.h() <= 1);
+        assert(first != nullptr || to1d(sz) == 0);
+    }
+
+    // Views the `sz` contiguous elements at `first`.
+    constexpr plane_view(T* const first, const size_type sz) noexcept
+      : plane_view{first, sz, sz.w()}
+    {
+    }
+
+    template <class Allocator>
+        requires std::convertible_to<value_type (*)[], T (*)[]>
+    constexpr plane_view(plane<value_type, Allocator>& p) noexcept
+      : plane_view{to1d(p).data(), p.size()}
+    {
+    }
+
+    template <class Allocator>
+        requires std::is_const_v<T>
+    constexpr plane_view(const plane<value_type, Allocator>& p) noexcept
+      : plane_view{to1d(p).data(), p.size()}
+    {
+    }
+
+    template <class Allocator>
+        requires std::convertible_to<value_type (*)[], T (*)[]>
+    constexpr plane_view(
+        plane<value_type, Allocator>& p, const subplane_type s) noexcept
+      : plane_view{plane_view{p}.subview(s)}
+    {
+    }
+
+    template <class Allocator>
+        requires std::is_const_v<T>
+    constexpr plane_view(
+        const plane<value_type, Allocator>& p, const subplane_type s) noexcept
+      : plane_view{plane_view{p}.subview(s)}
+    {
+    }
+
+    template <class U>
+        requires(!std::same_as<U, T>) &&
+        std::convertible_to<U (*)[], T (*)[]>
+    constexpr plane_view(const plane_view<U>& other) noexcept
+      : plane_view{other.data(), other.size(), other.row_stride()}
+    {
+    }
+
+    [[nodiscard]] constexpr T& operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return first[pt.y() * stride + pt.x()];
+    }
+
+    [[nodiscard]] constexpr std::span<T>
+    row(const std::size_t y) const noexcept
+    {
+        assert(y < sz.h());
+        return {first + y * stride, sz.w()};
+    }
+
+    // The view of subplane `s` of this view.
+    [[nodiscard]] constexpr plane_view
+    subview(const subplane_type s) const noexcept
+    {
+        assert(contains(sz, s));
+        if (to1d(s.size) == 0)
+            return {nullptr, s.size, stride};
+        return {&(*this)[s.top_left], s.size, stride};
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // Distance, in elements, between the starts of consecutive rows.
+    [[nodiscard]] constexpr std::size_t row_stride() const noexcept
+    {
+        return stride;
+    }
+
+    // The first element.
+    [[nodiscard]] constexpr T* data() const noexcept
+    {
+        return first;
+    }
+
+    // Whether the rows are adjacent, so that `data()` points to `to1d(size())`
+    // contiguous elements.
+    [[nodiscard]] constexpr bool is_contiguous() const noexcept
+    {
+        return stride == sz.w() || sz.h() <= 1;
+    }
+};
+
+template <class T>
+plane_view(T*, size2d<std::size_t>, std::size_t) -> plane_view<T>;
+
+template <class T>
+plane_view(T*, size2d<std::size_t>) -> plane_view<T>;
+
+template <class T, class Allocator>
+plane_view(plane<T, Allocator>&) -> plane_view<T>;
+
+template <class T, class Allocator>
+plane_view(const plane<T, Allocator>&) -> plane_view<const T>;
+
+template <class T, class Allocator>
+plane_view(plane<T, Allocator>&, subplane<std::size_t>) -> plane_view<T>;
+
+template <class T, class Allocator>
+plane_view(const plane<T, Allocator>&, subplane<std::size_t>)
+    -> plane_view<const T>;
+
+namespace detail
+{
+    template <class T>
+    inline constexpr bool is_plane_view_v = false;
+
+    template <class T>
+    inline constexpr bool is_plane_view_v<plane_view<T>> = true;
+
+    // An lvalue plane or a `plane_view`, from which a `plane_view` can be
+    // deduced. Views of rvalue planes would dangle.
+    template <class P>
+    concept viewable_plane =
+        (std::is_lvalue_reference_v<P> ||
+         is_plane_view_v<std::remove_cvref_t<P>>) &&
+        requires(P&& p) { plane_view{std::forward<P>(p)}; };
+
+    // The type of the elements of the view deduced from `P`.
+    template <class P>
+    using view_value_t =
+        typename decltype(plane_view{std::declval<P>()})::value_type;
+
+} // namespace detail
+
+} // namespace jge
+
+#endif // JGE_PLANE_VIEW_HPP
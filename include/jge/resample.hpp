@@ -0,0 +1,343 @@
+#ifndef JGE_RESAMPLE_HPP
+#define JGE_RESAMPLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/par.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/thread_pool.hpp>
+
+// Resampling of planes and plane views to other sizes. Element centers are
+// aligned, so that the element at `x` of a row of `n` elements covers
+// [`x`, `x + 1`) of [0, `n`), scaled to the other size.
+
+namespace jge
+{
+enum class resample_filter
+{
+    // The element whose center is nearest.
+    nearest,
+    // The interpolation of the four elements with the nearest centers,
+    // for magnification and moderate minification.
+    bilinear,
+    // The average of the elements under the area of each element, weighted
+    // by their coverage, for minification.
+    box,
+};
+
+namespace detail
+{
+    // The channels of the elements of a plane, which are either arithmetic
+    // or arrays of arithmetic channels, like RGBA pixels.
+    template <class T>
+    struct channels
+    {
+        using type = T;
+        static constexpr std::size_t count{1};
+
+        static constexpr T& get(T& e, std::size_t) noexcept
+        {
+            return e;
+        }
+
+        static constexpr const T& get(const T& e, std::size_t) noexcept
+        {
+            return e;
+        }
+    };
+
+    template <class C, std::size_t N>
+    struct channels<std::array<C, N>>
+    {
+        using type = C;
+        static constexpr std::size_t count{N};
+
+        static constexpr C& get(std::array<C, N>& e, std::size_t c) noexcept
+        {
+            return e[c];
+        }
+
+        static constexpr const C&
+        get(const std::array<C, N>& e, std::size_t c) noexcept
+        {
+            return e[c];
+        }
+    };
+
+    template <class T>
+    concept filterable =
+        std::is_arithmetic_v<typename channels<T>::type> &&
+        !std::is_same_v<typename channels<T>::type, bool>;
+
+    // The type in which the channels of `T` are filtered.
+    template <class T>
+    using filter_t = std::conditional_t<
+        std::is_floating_point_v<typename channels<T>::type>,
+        typename channels<T>::type,
+        std::conditional_t<
+            (sizeof(typename channels<T>::type) <= 2), float, double>>;
+
+    // `v` rounded half away from zero, and clamped to the range of `C`.
+    // Avoids `std::round`, which is a library call in vectorized loops.
+    template <class C, class F>
+    C to_channel(const F v) noexcept
+    {
+        if constexpr (std::is_floating_point_v<C>)
+            return static_cast<C>(v);
+        else
+        {
+            using limits = std::numeric_limits<C>;
+            // The greatest `F` that converts to `C`.
+            const F max{
+                limits::digits > std::numeric_limits<F>::digits
+                    ? std::nextafter(F(limits::max()), F{0})
+                    : F(limits::max())};
+            const F r{v < 0 ? v - F(0.5) : v + F(0.5)};
+            return static_cast<C>(std::clamp(r, F(limits::lowest()), max));
+        }
+    }
+
+    // For each element `i` of a row of `to` elements, the index of the
+    // element of a row of `from` elements whose center is nearest.
+    inline std::vector<std::size_t>
+    nearest_indices(const std::size_t from, const std::size_t to)
+    {
+        std::vector<std::size_t> res(to);
+        for (std::size_t i{0}; i != to; ++i)
+            res[i] = std::min((2 * i + 1) * from / (2 * to), from - 1);
+        return res;
+    }
+
+    // For each element `i` of a row resampled to another size, the weights
+    // of the `size(i)` consecutive elements of the original row from
+    // `first[i]`.
+    template <class F>
+    struct taps
+    {
+        std::vector<std::size_t> first;
+        std::vector<std::size_t> offset{0};
+        std::vector<F> weights;
+
+        [[nodiscard]] std::size_t size(const std::size_t i) const noexcept
+        {
+            return offset[i + 1] - offset[i];
+        }
+
+        [[nodiscard]] std::span<const F>
+        weights_of(const std::size_t i) const noexcept
+        {
+            return {weights.data() + offset[i], size(i)};
+        }
+
+        void push_back(const std::size_t f, const std::span<const double> w)
+        {
+            first.push_back(f);
+            weights.insert(weights.end(), w.begin(), w.end());
+            offset.push_back(weights.size());
+        }
+    };
+
+    template <class F>
+    taps<F> bilinear_taps(const std::size_t from, const std::size_t to)
+    {
+        taps<F> res;
+        const double scale{double(from) / double(to)};
+        for (std::size_t i{0}; i != to; ++i)
+        {
+            const double s{std::clamp(
+                (double(i) + 0.5) * scale - 0.5, 0.0, double(from - 1))};
+            const auto i0{static_cast<std::size_t>(s)};
+            const double f{s - double(i0)};
+            if (i0 + 1 == from || f == 0)
+                res.push_back(i0, std::array{1.0});
+            else
+                res.push_back(i0, std::array{1 - f, f});
+        }
+        return res;
+    }
+
+    template <class F>
+    taps<F> box_taps(const std::size_t from, const std::size_t to)
+    {
+        taps<F> res;
+        const double scale{double(from) / double(to)};
+        std::vector<double> w;
+        for (std::size_t i{0}; i != to; ++i)
+        {
+            const double a{double(i) * scale};
+            const double b{double(i + 1) * scale};
+            const auto first{static_cast<std::size_t>(a)};
+            const auto last{std::min(
+                static_cast<std::size_t>(std::ceil(b)), from)};
+            w.clear();
+            for (std::size_t j{first}; j != last; ++j)
+                w.push_back(
+                    (std::min(b, double(j + 1)) - std::max(a, double(j))) /
+                    scale);
+            res.push_back(first, w);
+        }
+        return res;
+    }
+
+    template <class T, class U>
+    void resample_nearest(
+        const plane_view<T> from, const plane_view<U> to, thread_pool& pool)
+    {
+        const std::vector<std::size_t> xs{
+            nearest_indices(from.size().w(), to.size().w())};
+        const std::vector<std::size_t> ys{
+            nearest_indices(from.size().h(), to.size().h())};
+        par::detail::for_each_band(
+            pool, {pool, to.size(), sizeof(U)},
+            [&](std::size_t, const std::size_t first, const std::size_t last) {
+                for (std::size_t y{first}; y != last; ++y)
+                {
+                    const std::span<T> in{from.row(ys[y])};
+                    const std::span<U> out{to.row(y)};
+                    for (std::size_t x{0}; x != out.size(); ++x)
+                        out[x] = in[xs[x]];
+                }
+            });
+    }
+
+    // Resamples with the separable filter of `x_taps` and `y_taps`. Each
+    // row of `to` is the rows of `from` weighted by `y_taps`, accumulated
+    // into a row of `filter_t` channels, and then resampled by `x_taps`.
+    template <class T, class U, class F>
+    void resample_separable(
+        const plane_view<T> from, const plane_view<U> to,
+        const taps<F>& x_taps, const taps<F>& y_taps, thread_pool& pool)
+    {
+        using in_channels  = channels<std::remove_cv_t<T>>;
+        using out_channels = channels<U>;
+        constexpr std::size_t n{in_channels::count};
+        static_assert(n == out_channels::count);
+        using C = typename out_channels::type;
+        par::detail::for_each_band(
+            pool, {pool, to.size(), sizeof(U)},
+            [&](std::size_t, const std::size_t first, const std::size_t last) {
+                // Locals, as stores of byte channels may alias anything else.
+                const std::size_t w{from.size().w()};
+                std::vector<F> column(w * n);
+                F* const sums{column.data()};
+                for (std::size_t y{first}; y != last; ++y)
+                {
+                    std::ranges::fill(column, F{});
+                    const std::span<const F> wy{y_taps.weights_of(y)};
+                    for (std::size_t k{0}; k != wy.size(); ++k)
+                    {
+                        const F wk{wy[k]};
+                        T* const in{from.row(y_taps.first[y] + k).data()};
+                        for (std::size_t x{0}; x != w; ++x)
+                            for (std::size_t c{0}; c != n; ++c)
+                                sums[x * n + c] +=
+                                    wk * F(in_channels::get(in[x], c));
+                    }
+                    const std::span<U> out{to.row(y)};
+                    for (std::size_t x{0}; x != out.size(); ++x)
+                    {
+                        const std::span<const F> wx{x_taps.weights_of(x)};
+                        const F* const col{sums + x_taps.first[x] * n};
+                        std::array<F, n> acc{};
+                        for (std::size_t k{0}; k != wx.size(); ++k)
+                            for (std::size_t c{0}; c != n; ++c)
+                                acc[c] += wx[k] * col[k * n + c];
+                        for (std::size_t c{0}; c != n; ++c)
+                            out_channels::get(out[x], c) =
+                                to_channel<C>(acc[c]);
+                    }
+                }
+            });
+    }
+
+} // namespace detail
+
+// Resamples `from` to the size of `to` with the `nearest` filter, for
+// elements of any type. They do not overlap.
+template <detail::viewable_plane From, detail::viewable_plane To>
+void resample_nearest(
+    From&& from, To&& to, thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    if (to1d(dst.size()) == 0)
+        return;
+    assert(to1d(src.size()) != 0);
+    detail::resample_nearest(src, dst, pool);
+}
+
+// The plane of size `sz` resampled from `from` with the `nearest` filter.
+template <detail::viewable_plane From>
+[[nodiscard]] plane<detail::view_value_t<From>> resample_nearest(
+    From&& from, const size2d<std::size_t> sz,
+    thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    if (to1d(sz) == 0)
+        return {};
+    plane<detail::view_value_t<From>> res{sz, for_overwrite};
+    resample_nearest(src, res, pool);
+    return res;
+}
+
+// Resamples `from` to the size of `to` with `filter`. They do not overlap.
+// The elements are of arithmetic types or arrays of them, whose channels
+// are filtered in floating point and rounded to the nearest representable
+// value. Elements of other types are resampled by `resample_nearest`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+    requires detail::filterable<detail::view_value_t<From>> &&
+             detail::filterable<detail::view_value_t<To>>
+void resample(
+    From&& from, To&& to,
+    const resample_filter filter = resample_filter::bilinear,
+    thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    using T = typename decltype(src)::value_type;
+    if (to1d(dst.size()) == 0)
+        return;
+    assert(to1d(src.size()) != 0);
+    if (filter == resample_filter::nearest)
+    {
+        detail::resample_nearest(src, dst, pool);
+        return;
+    }
+    using F = detail::filter_t<T>;
+    const auto make_taps{
+        filter == resample_filter::box ? detail::box_taps<F>
+                                       : detail::bilinear_taps<F>};
+    detail::resample_separable(
+        src, dst, make_taps(src.size().w(), dst.size().w()),
+        make_taps(src.size().h(), dst.size().h()), pool);
+}
+
+// The plane of size `sz` resampled from `from` with `filter`.
+template <detail::viewable_plane From>
+    requires detail::filterable<detail::view_value_t<From>>
+[[nodiscard]] plane<detail::view_value_t<From>> resample(
+    From&& from, const size2d<std::size_t> sz,
+    const resample_filter filter = resample_filter::bilinear,
+    thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    if (to1d(sz) == 0)
+        return {};
+    plane<detail::view_value_t<From>> res{sz, for_overwrite};
+    resample(src, res, filter, pool);
+    return res;
+}
+
+} // namespace jge
+
+#endif // JGE_RESAMPLE_HPP
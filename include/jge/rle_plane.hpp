@@ -0,0 +1,136 @@
+#ifndef JGE_RLE_PLANE_HPP
+#define JGE_RLE_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+namespace jge
+{
+// A read-only plane that stores each row as runs of equal elements.
+// Accessing an element searches the runs of its row.
+template <class T>
+    requires std::copyable<T> && std::equality_comparable<T>
+class [[nodiscard]] rle_plane
+{
+public:
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+    // `length` elements equal to `value`, starting at abscissa `x`.
+    struct run_type
+    {
+        std::size_t x;
+        std::size_t length;
+        T value;
+
+        [[nodiscard]] friend bool
+        operator==(const run_type&, const run_type&) = default;
+    };
+
+private:
+    size_type sz{};
+    std::vector<run_type> runs;
+    // The runs of row `y` are [row_runs[y], row_runs[y + 1]).
+    std::vector<std::size_t> row_runs{0};
+
+public:
+    rle_plane() = default;
+
+    // Compresses the elements of `r`, in row-major order.
+    template <std::ranges::sized_range R>
+        requires std::ranges::input_range<R> &&
+            std::constructible_from<T, std::ranges::range_reference_t<R>>
+    rle_plane(R&& r, const width_type w)
+      : sz{to_size(std::ranges::size(r), w)}
+    {
+        row_runs.reserve(sz.h() + 1);
+        std::size_t x{0};
+        for (auto&& e : r)
+        {
+            if (x == 0 || !(runs.back().value == e))
+                runs.push_back({x, 1, T(std::forward<decltype(e)>(e))});
+            else
+                ++runs.back().length;
+            if (++x == w())
+            {
+                x = 0;
+                row_runs.push_back(runs.size());
+            }
+        }
+        runs.shrink_to_fit();
+    }
+
+    rle_plane(const std::initializer_list<std::initializer_list<T>> il2d)
+      : rle_plane{plane<T>{il2d}}
+    {
+    }
+
+    template <class Allocator>
+    explicit rle_plane(const plane<T, Allocator>& p)
+      : rle_plane{to1d(p), p.size().w}
+    {
+    }
+
+    template <class Allocator>
+    explicit operator plane<T, Allocator>() const
+    {
+        std::vector<T> elements;
+        elements.reserve(to1d(sz));
+        for (const run_type& r : runs)
+            elements.insert(elements.end(), r.length, r.value);
+        return {elements, sz.w};
+    }
+
+    [[nodiscard]] const T& operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        const std::span<const run_type> row{row_runs_of(pt.y())};
+        return std::ranges::prev(std::ranges::upper_bound(
+                                     row, pt.x(), {}, &run_type::x))
+            ->value;
+    }
+
+    size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // The runs of row `y`, from left to right.
+    [[nodiscard]] std::span<const run_type>
+    row_runs_of(const std::size_t y) const noexcept
+    {
+        assert(y < sz.h());
+        return std::span{runs}.subspan(
+            row_runs[y], row_runs[y + 1] - row_runs[y]);
+    }
+
+    // The runs of all rows, in row-major order.
+    [[nodiscard]] std::span<const run_type> all_runs() const noexcept
+    {
+        return runs;
+    }
+
+    [[nodiscard]] std::size_t run_count() const noexcept
+    {
+        return runs.size();
+    }
+
+    [[nodiscard]] bool operator==(const rle_plane& other) const noexcept
+    {
+        return sz == other.sz && runs == other.runs;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_RLE_PLANE_HPP
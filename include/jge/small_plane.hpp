@@ -0,0 +1,389 @@
+#ifndef JGE_SMALL_PLANE_HPP
+#define JGE_SMALL_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/detail/memory.hpp>
+#include <jge/plane.hpp>
+#include <lift.hpp>
+
+namespace jge
+{
+// A plane that keeps up to `N` elements inline, and only allocates above
+// that. Moving an inline plane moves its elements.
+// During constant evaluation, elements are always allocated.
+template <class T, std::size_t N, class Allocator = std::allocator<T>>
+class [[nodiscard]] small_plane
+{
+    static_assert(N != 0);
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::same_as<typename alloc_traits::value_type, T>);
+    static_assert(std::same_as<typename alloc_traits::pointer, T*>);
+
+public:
+    using allocator_type = Allocator;
+    using width_type     = width<std::size_t>;
+    using size_type      = size2d<width_type::rep>;
+    using point_type     = point2d<size_type::rep>;
+
+    static constexpr std::size_t inline_capacity{N};
+
+private:
+    [[no_unique_address]] Allocator alloc{};
+    T* data{};
+    size_type sz{};
+    alignas(T) std::byte buffer[N * sizeof(T)];
+
+    static constexpr bool fits_inline(const std::size_t n) noexcept
+    {
+        return !std::is_constant_evaluated() && n <= N;
+    }
+
+    constexpr T* allocate(const std::size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+        if (fits_inline(n))
+            return reinterpret_cast<T*>(buffer);
+        return alloc_traits::allocate(alloc, n);
+    }
+
+    constexpr void deallocate(T* const p, const std::size_t n) noexcept
+    {
+        if (p != nullptr && !fits_inline(n))
+            alloc_traits::deallocate(alloc, p, n);
+    }
+
+    // Allocates storage for `sz` and constructs its elements with `construct`.
+    // Releases the storage and leaves `*this` empty if `construct` throws.
+    constexpr void create(auto construct)
+    {
+        assert(data == nullptr);
+        data = allocate(to1d(sz));
+        try
+        {
+            construct(std::span{data, to1d(sz)});
+        }
+        catch (...)
+        {
+            deallocate(std::exchange(data, nullptr), to1d(sz));
+            sz = {};
+            throw;
+        }
+    }
+
+    constexpr void destroy() noexcept
+    {
+        detail::destroy(alloc, to1d(*this));
+        deallocate(std::exchange(data, nullptr), to1d(sz));
+    }
+
+    static constexpr auto moved_elements(small_plane& p) noexcept
+    {
+        return std::ranges::subrange{
+            std::make_move_iterator(to1d(p).begin()),
+            std::make_move_iterator(to1d(p).end())};
+    }
+
+    // Takes the elements of `other`, leaving it empty.
+    // Requires `*this` to be empty, and allocators that compare equal.
+    // If moving an element throws, `*this` stays empty and `other` keeps its
+    // elements.
+    constexpr void steal(small_plane& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        assert(data == nullptr);
+        if (!fits_inline(to1d(other.sz)))
+        {
+            data = std::exchange(other.data, nullptr);
+            sz   = std::exchange(other.sz, {});
+            return;
+        }
+        sz = other.sz;
+        create([&](const std::span<T> s) {
+            detail::uninitialized_copy(alloc, moved_elements(other), s);
+        });
+        other.destroy();
+        other.sz = {};
+    }
+
+public:
+    constexpr ~small_plane() requires std::destructible<T>
+    {
+        destroy();
+    }
+
+    constexpr small_plane() noexcept(
+        std::is_nothrow_default_constructible_v<Allocator>)
+    {
+    }
+
+    constexpr explicit small_plane(const Allocator& a) noexcept : alloc{a}
+    {
+    }
+
+    constexpr small_plane(const small_plane& other) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : small_plane{
+            to1d(other), other.sz.w,
+            alloc_traits::select_on_container_copy_construction(other.alloc)}
+    {
+    }
+
+    constexpr small_plane(const small_plane& other, const Allocator& a) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : small_plane{to1d(other), other.sz.w, a}
+    {
+    }
+
+    constexpr small_plane& operator=(const small_plane& other) noexcept(
+        (std::is_nothrow_copy_constructible_v<small_plane> &&
+         std::is_nothrow_copy_assignable_v<T>)) requires std::copyable<T>
+    {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                          value)
+        {
+            if (alloc != other.alloc)
+            {
+                destroy();
+                sz = {};
+            }
+            alloc = other.alloc;
+        }
+        assign(to1d(other), other.sz.w);
+        return *this;
+    }
+
+    constexpr small_plane(small_plane&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+      : alloc{std::move(other.alloc)}
+    {
+        steal(other);
+    }
+
+    constexpr small_plane(small_plane&& other, const Allocator& a) : alloc{a}
+    {
+        if (alloc == other.alloc)
+            steal(other);
+        else
+            assign(moved_elements(other), other.sz.w);
+    }
+
+    constexpr small_plane& operator=(small_plane&& other) noexcept(
+        ((alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_traits::is_always_equal::value) &&
+         std::is_nothrow_move_constructible_v<T>))
+    {
+        constexpr bool propagate{
+            alloc_traits::propagate_on_container_move_assignment::value};
+        if constexpr (!propagate)
+            if (alloc != other.alloc)
+            {
+                assign(moved_elements(other), other.sz.w);
+                return *this;
+            }
+        const auto swap_allocators = [&] {
+            if constexpr (propagate)
+            {
+                using std::swap;
+                swap(alloc, other.alloc);
+            }
+        };
+        small_plane tmp{alloc};
+        tmp.steal(*this);
+        swap_allocators();
+        if constexpr (std::is_nothrow_move_constructible_v<T>)
+            steal(other);
+        else
+            try
+            {
+                steal(other);
+            }
+            catch (...)
+            {
+                // Takes back the elements of `*this`.
+                swap_allocators();
+                steal(tmp);
+                throw;
+            }
+        other.steal(tmp);
+        return *this;
+    }
+
+    constexpr explicit small_plane(
+        const size_type sz, default_initialize_t,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_default_constructible_v<T>)) requires
+        std::default_initializable<T>
+      : alloc{a}, sz{sz}
+    {
+        assert(sz == size_type{} || to1d(sz) != 0);
+        create([&](const std::span<T> s) {
+            detail::uninitialized_default_construct(alloc, s);
+        });
+    }
+
+    constexpr explicit small_plane(
+        const size_type sz, value_initialize_t,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_default_constructible_v<T>)) requires
+        std::default_initializable<T>
+      : alloc{a}, sz{sz}
+    {
+        assert(sz == size_type{} || to1d(sz) != 0);
+        create([&](const std::span<T> s) {
+            detail::uninitialized_value_construct(alloc, s);
+        });
+    }
+
+    constexpr small_plane(
+        const std::initializer_list<std::initializer_list<T>> il2d,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : alloc{a}
+    {
+        *this = il2d;
+    }
+
+    constexpr small_plane&
+    operator=(const std::initializer_list<std::initializer_list<T>> il2d) noexcept(
+        (std::is_nothrow_constructible_v<small_plane, decltype(il2d)> &&
+         std::is_nothrow_copy_assignable_v<T>)) requires std::copyable<T>
+    {
+        const width_type w{empty(il2d) ? 0 : il2d.begin()->size()};
+        assert(std::ranges::all_of(il2d, lift::equal(w()), std::ranges::size));
+        const std::ranges::join_view il1d{il2d};
+        assign(std::ranges::subrange{il1d, il2d.size() * w()}, w);
+        return *this;
+    }
+
+    constexpr small_plane(
+        const std::initializer_list<T> il, const width_type w,
+        const Allocator& a = Allocator()) noexcept(
+        (detail::allocator_is_nothrow<Allocator> &&
+         std::is_nothrow_copy_constructible_v<T>)) requires std::copyable<T>
+      : small_plane{std::span{il}, w, a}
+    {
+    }
+
+    constexpr void
+    assign(const std::initializer_list<T> il, const width_type w) noexcept(
+        (std::is_nothrow_constructible_v<small_plane, decltype(il), width_type> &&
+         std::is_nothrow_copy_assignable_v<T>)) requires std::copyable<T>
+    {
+        assign(std::span{il}, w);
+    }
+
+    template <std::ranges::sized_range R>
+        requires std::ranges::input_range<R> &&
+            std::constructible_from<T, std::ranges::range_reference_t<R>>
+    constexpr small_plane(
+        R&& r, const width_type w, const Allocator& a = Allocator())
+      : alloc{a}, sz{to_size(std::ranges::size(r), w)}
+    {
+        create([&](const std::span<T> s) {
+            detail::uninitialized_copy(alloc, std::forward<R>(r), s);
+        });
+    }
+
+    template <class R>
+        requires std::constructible_from<small_plane, R, width_type, Allocator>
+    constexpr void assign(R&& r, const width_type w)
+    {
+        if (to1d(sz) != std::ranges::size(r))
+        {
+            small_plane other{std::forward<R>(r), w, alloc};
+            destroy();
+            sz = {};
+            steal(other);
+            return;
+        }
+
+        sz = to_size(std::ranges::size(r), w);
+        std::ranges::copy(std::forward<R>(r), data);
+    }
+
+    template <class Allocator2>
+        requires std::copyable<T>
+    constexpr explicit operator plane<T, Allocator2>() const
+    {
+        return {to1d(*this), sz.w};
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept
+    {
+        return alloc;
+    }
+
+    [[nodiscard]] constexpr T& operator[](const point_type pt) noexcept
+    {
+        return const_cast<T&>(std::as_const(*this)[pt]);
+    }
+
+    [[nodiscard]] constexpr const T&
+    operator[](const point_type pt) const noexcept
+    {
+        assert(contains(sz, pt));
+        return data[to1d(pt, sz)];
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return sz;
+    }
+
+    // Whether the elements are stored inline.
+    [[nodiscard]] constexpr bool is_small() const noexcept
+    {
+        return fits_inline(to1d(sz));
+    }
+
+    [[nodiscard]] constexpr bool operator==(const small_plane& other) const
+        noexcept requires std::equality_comparable<T>
+    {
+        constexpr auto gcc95806 = std::views::transform(std::identity{});
+        return sz == other.sz &&
+               std::ranges::equal(to1d(*this) | gcc95806, to1d(other));
+    }
+
+    [[nodiscard]] friend constexpr std::span<T> to1d(small_plane& p) noexcept
+    {
+        return {p.data, to1d(p.sz)};
+    }
+
+    [[nodiscard]] friend constexpr std::span<const T>
+    to1d(const small_plane& p) noexcept
+    {
+        return to1d(const_cast<small_plane&>(p));
+    }
+};
+
+namespace pmr
+{
+    template <class T, std::size_t N>
+    using small_plane =
+        jge::small_plane<T, N, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+} // namespace jge
+
+#endif // JGE_SMALL_PLANE_HPP
@@ -0,0 +1,134 @@
+#ifndef JGE_SOA_PLANE_HPP
+#define JGE_SOA_PLANE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <lift.hpp>
+
+namespace jge
+{
+// A plane of tuples of `Fields`, each of which is stored in a plane of its
+// own. Elements are accessed through tuples of references to their fields.
+template <class... Fields>
+class [[nodiscard]] soa_plane
+{
+    static_assert(sizeof...(Fields) != 0);
+
+public:
+    using value_type      = std::tuple<Fields...>;
+    using reference       = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using width_type      = width<std::size_t>;
+    using size_type       = size2d<width_type::rep>;
+    using point_type      = point2d<size_type::rep>;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+private:
+    std::tuple<plane<Fields>...> fields;
+
+    static constexpr auto indices{std::index_sequence_for<Fields...>{}};
+
+public:
+    constexpr soa_plane() = default;
+
+    constexpr explicit soa_plane(
+        const size_type sz, default_initialize_t) requires(
+        std::default_initializable<Fields>&&...)
+      : fields{plane<Fields>{sz, default_initialize}...}
+    {
+    }
+
+    constexpr explicit soa_plane(
+        const size_type sz, value_initialize_t) requires(
+        std::default_initializable<Fields>&&...)
+      : fields{plane<Fields>{sz, value_initialize}...}
+    {
+    }
+
+    // Takes each field's plane. Requires them to be of the same size.
+    constexpr explicit soa_plane(plane<Fields>... ps) noexcept
+      : fields{std::move(ps)...}
+    {
+        assert(std::apply(
+            [](const auto& first, const auto&... rest) {
+                return ((rest.size() == first.size()) && ...);
+            },
+            fields));
+    }
+
+    constexpr soa_plane(
+        const std::initializer_list<std::initializer_list<value_type>>
+            il2d) requires(std::default_initializable<Fields>&&...)
+      : soa_plane{
+            width_type{empty(il2d) ? 0 : il2d.begin()->size()} +
+                height{il2d.size()},
+            value_initialize}
+    {
+        assert(std::ranges::all_of(
+            il2d, lift::equal(size().w()), std::ranges::size));
+        std::size_t y{0};
+        for (const std::initializer_list<value_type> row : il2d)
+        {
+            std::size_t x{0};
+            for (const value_type& e : row)
+                (*this)[abscissa{x++} + ordinate{y}] = e;
+            ++y;
+        }
+    }
+
+    [[nodiscard]] constexpr reference operator[](const point_type pt) noexcept
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return reference{std::get<I>(fields)[pt]...};
+        }(indices);
+    }
+
+    [[nodiscard]] constexpr const_reference
+    operator[](const point_type pt) const noexcept
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return const_reference{std::get<I>(fields)[pt]...};
+        }(indices);
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return std::get<0>(fields).size();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const soa_plane& other) const
+        noexcept requires(std::equality_comparable<Fields>&&...)
+    {
+        return fields == other.fields;
+    }
+
+    // The elements of the `I`th field, in row-major order.
+    template <std::size_t I>
+    [[nodiscard]] friend constexpr std::span<field_type<I>>
+    to1d(soa_plane& p) noexcept
+    {
+        return to1d(std::get<I>(p.fields));
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] friend constexpr std::span<const field_type<I>>
+    to1d(const soa_plane& p) noexcept
+    {
+        return to1d(std::get<I>(p.fields));
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_SOA_PLANE_HPP
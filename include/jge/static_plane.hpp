@@ -0,0 +1,118 @@
+#ifndef JGE_STATIC_PLANE_HPP
+#define JGE_STATIC_PLANE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <lift.hpp>
+
+namespace jge
+{
+// A plane of compile-time extents that keeps its elements inline.
+template <class T, std::size_t W, std::size_t H>
+class [[nodiscard]] static_plane
+{
+    static_assert((W == 0) == (H == 0));
+
+public:
+    using width_type = width<std::size_t>;
+    using size_type  = size2d<width_type::rep>;
+    using point_type = point2d<size_type::rep>;
+
+private:
+    std::array<T, W * H> data;
+
+public:
+    constexpr static_plane() noexcept(
+        std::is_nothrow_default_constructible_v<T>) requires
+        std::default_initializable<T> : data{}
+    {
+    }
+
+    constexpr explicit static_plane(default_initialize_t) noexcept(
+        std::is_nothrow_default_constructible_v<T>) requires
+        std::default_initializable<T>
+    {
+    }
+
+    constexpr explicit static_plane(value_initialize_t) noexcept(
+        std::is_nothrow_default_constructible_v<T>) requires
+        std::default_initializable<T>
+      : data{}
+    {
+    }
+
+    constexpr static_plane(
+        const std::initializer_list<std::initializer_list<T>> il2d) noexcept(
+        (std::is_nothrow_default_constructible_v<T> &&
+         std::is_nothrow_copy_assignable_v<T>)) requires std::copyable<T>
+      : data{}
+    {
+        assert(il2d.size() == H);
+        assert(std::ranges::all_of(il2d, lift::equal(W), std::ranges::size));
+        std::ranges::copy(std::ranges::join_view{il2d}, data.begin());
+    }
+
+    template <class Allocator>
+        requires std::copyable<T>
+    constexpr explicit static_plane(const plane<T, Allocator>& p) noexcept(
+        (std::is_nothrow_default_constructible_v<T> &&
+         std::is_nothrow_copy_assignable_v<T>))
+      : data{}
+    {
+        assert(p.size() == size());
+        std::ranges::copy(to1d(p), data.begin());
+    }
+
+    template <class Allocator>
+        requires std::copyable<T>
+    constexpr explicit operator plane<T, Allocator>() const
+    {
+        return {to1d(*this), size().w};
+    }
+
+    [[nodiscard]] constexpr T& operator[](const point_type pt) noexcept
+    {
+        return const_cast<T&>(std::as_const(*this)[pt]);
+    }
+
+    [[nodiscard]] constexpr const T&
+    operator[](const point_type pt) const noexcept
+    {
+        assert(contains(size(), pt));
+        return data[to1d(pt, size())];
+    }
+
+    static constexpr size_type size() noexcept
+    {
+        return {width_type{W}, height<std::size_t>{H}};
+    }
+
+    [[nodiscard]] constexpr bool
+    operator==(const static_plane&) const = default;
+
+    [[nodiscard]] friend constexpr std::span<T, W * H>
+    to1d(static_plane& p) noexcept
+    {
+        return p.data;
+    }
+
+    [[nodiscard]] friend constexpr std::span<const T, W * H>
+    to1d(const static_plane& p) noexcept
+    {
+        return p.data;
+    }
+};
+
+} // namespace jge
+
+#endif // JGE_STATIC_PLANE_HPP
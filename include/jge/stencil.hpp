@@ -0,0 +1,416 @@
+#ifndef JGE_STENCIL_HPP
+#define JGE_STENCIL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/par.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/thread_pool.hpp>
+
+// Neighborhood stencils and convolutions over planes and plane views.
+// The elements on the edges, whose neighborhoods reach outside the plane,
+// are processed apart from the interior, which is read without checks.
+// Rows are split into bands that run on a `thread_pool`. The source and
+// destination are of the same size, and do not overlap.
+
+namespace jge
+{
+// Policies for the elements outside a plane. The examples show a row
+// `abcd` with two elements of border on each side.
+namespace border
+{
+    // `aa|abcd|dd`
+    struct clamp
+    {
+        [[nodiscard]] static constexpr std::size_t
+        index(const std::ptrdiff_t i, const std::size_t n) noexcept
+        {
+            return static_cast<std::size_t>(
+                std::clamp(i, std::ptrdiff_t{0}, std::ptrdiff_t(n) - 1));
+        }
+    };
+
+    // `cd|abcd|ab`
+    struct wrap
+    {
+        [[nodiscard]] static constexpr std::size_t
+        index(const std::ptrdiff_t i, const std::size_t n) noexcept
+        {
+            const auto m{static_cast<std::ptrdiff_t>(n)};
+            return static_cast<std::size_t>((i % m + m) % m);
+        }
+    };
+
+    // `ba|abcd|dc`
+    struct mirror
+    {
+        [[nodiscard]] static constexpr std::size_t
+        index(const std::ptrdiff_t i, const std::size_t n) noexcept
+        {
+            const auto m{static_cast<std::ptrdiff_t>(n)};
+            const std::ptrdiff_t j{(i % (2 * m) + 2 * m) % (2 * m)};
+            return static_cast<std::size_t>(j < m ? j : 2 * m - 1 - j);
+        }
+    };
+
+    // `vv|abcd|vv`, where `v` is `value`.
+    template <class T>
+    struct constant
+    {
+        T value{};
+    };
+
+    template <class T>
+    constant(T) -> constant<T>;
+
+} // namespace border
+
+namespace detail
+{
+    template <class T>
+    inline constexpr bool is_constant_border_v = false;
+
+    template <class T>
+    inline constexpr bool is_constant_border_v<border::constant<T>> = true;
+
+    // The element of `v` at (`x`, `y`), which may be outside it.
+    template <class T, class Border>
+    constexpr std::remove_cv_t<T> border_at(
+        const Border& b, const plane_view<T> v, const std::ptrdiff_t x,
+        const std::ptrdiff_t y)
+    {
+        const auto w{static_cast<std::ptrdiff_t>(v.size().w())};
+        const auto h{static_cast<std::ptrdiff_t>(v.size().h())};
+        if constexpr (is_constant_border_v<Border>)
+        {
+            if (x < 0 || y < 0 || x >= w || y >= h)
+                return static_cast<std::remove_cv_t<T>>(b.value);
+            return v[abscissa{std::size_t(x)} + ordinate{std::size_t(y)}];
+        }
+        else
+        {
+            if (0 <= x && 0 <= y && x < w && y < h)
+                return v[abscissa{std::size_t(x)} + ordinate{std::size_t(y)}];
+            return v
+                [abscissa{Border::index(x, v.size().w())} +
+                 ordinate{Border::index(y, v.size().h())}];
+        }
+    }
+
+    // The extent of a neighborhood around its anchor, in each direction.
+    struct reach
+    {
+        std::size_t left{};
+        std::size_t right{};
+        std::size_t up{};
+        std::size_t down{};
+    };
+
+    // For each row `y` in [`first`, `last`) of a plane of size `sz`, calls
+    // `edge(x, y)` for each element whose neighborhood of reach `r` is not
+    // inside the plane, and `interior(y, x0, x1)` for the elements in
+    // [`x0`, `x1`) whose neighborhood is.
+    template <class Edge, class Interior>
+    void for_each_region(
+        const size2d<std::size_t> sz, const reach r, const std::size_t first,
+        const std::size_t last, const Edge& edge, const Interior& interior)
+    {
+        const std::size_t x0{std::min(r.left, sz.w())};
+        const std::size_t x1{
+            std::max(x0, sz.w() > r.right ? sz.w() - r.right : 0)};
+        for (std::size_t y{first}; y != last; ++y)
+        {
+            if (y < r.up || y + r.down >= sz.h())
+            {
+                for (std::size_t x{0}; x != sz.w(); ++x)
+                    edge(x, y);
+                continue;
+            }
+            for (std::size_t x{0}; x != x0; ++x)
+                edge(x, y);
+            if (x0 != x1)
+                interior(y, x0, x1);
+            for (std::size_t x{x1}; x != sz.w(); ++x)
+                edge(x, y);
+        }
+    }
+
+    template <class T, class W>
+    using accumulator_t =
+        std::remove_cvref_t<decltype(std::declval<W>() * std::declval<T>())>;
+
+    // Correlates each row of `from` with `weights` into `to`, where the
+    // weight `weights[anchor]` applies to the element itself.
+    template <class T, class U, class W, std::size_t N, class Border>
+    void correlate_rows(
+        const plane_view<T> from, const plane_view<U> to,
+        const std::span<const W, N> weights, const std::size_t anchor,
+        const Border& b, thread_pool& pool)
+    {
+        using A = accumulator_t<std::remove_cv_t<T>, W>;
+        const reach r{anchor, weights.size() - 1 - anchor, 0, 0};
+        const auto off{static_cast<std::ptrdiff_t>(anchor)};
+        par::detail::for_each_band(
+            pool, {pool, from.size(), sizeof(T) * weights.size()},
+            [&](std::size_t, const std::size_t first, const std::size_t last) {
+                for_each_region(
+                    from.size(), r, first, last,
+                    [&](const std::size_t x, const std::size_t y) {
+                        A acc{};
+                        for (std::size_t k{0}; k != weights.size(); ++k)
+                            acc += weights[k] *
+                                   border_at(
+                                       b, from,
+                                       std::ptrdiff_t(x + k) - off,
+                                       std::ptrdiff_t(y));
+                        to[abscissa{x} + ordinate{y}] = static_cast<U>(acc);
+                    },
+                    [&](const std::size_t y, const std::size_t x0,
+                        const std::size_t x1) {
+                        T* const in{from.row(y).data() + (x0 - anchor)};
+                        U* const out{to.row(y).data() + x0};
+                        for (std::size_t i{0}; i != x1 - x0; ++i)
+                        {
+                            A acc{};
+                            for (std::size_t k{0}; k != weights.size(); ++k)
+                                acc += weights[k] * in[i + k];
+                            out[i] = static_cast<U>(acc);
+                        }
+                    });
+            });
+    }
+
+    // Correlates each column of `from` with `weights` into `to`, where the
+    // weight `weights[anchor]` applies to the element itself. The interior
+    // accumulates whole rows, so that it vectorizes along x.
+    template <class T, class U, class W, std::size_t N, class Border>
+    void correlate_columns(
+        const plane_view<T> from, const plane_view<U> to,
+        const std::span<const W, N> weights, const std::size_t anchor,
+        const Border& b, thread_pool& pool)
+    {
+        using A = accumulator_t<std::remove_cv_t<T>, W>;
+        const reach r{0, 0, anchor, weights.size() - 1 - anchor};
+        const auto off{static_cast<std::ptrdiff_t>(anchor)};
+        par::detail::for_each_band(
+            pool, {pool, from.size(), sizeof(T) * weights.size()},
+            [&](std::size_t, const std::size_t first, const std::size_t last) {
+                std::vector<A> acc(from.size().w());
+                for_each_region(
+                    from.size(), r, first, last,
+                    [&](const std::size_t x, const std::size_t y) {
+                        A sum{};
+                        for (std::size_t k{0}; k != weights.size(); ++k)
+                            sum += weights[k] *
+                                   border_at(
+                                       b, from, std::ptrdiff_t(x),
+                                       std::ptrdiff_t(y + k) - off);
+                        to[abscissa{x} + ordinate{y}] = static_cast<U>(sum);
+                    },
+                    [&](const std::size_t y, const std::size_t x0,
+                        const std::size_t x1) {
+                        A* const sums{acc.data() + x0};
+                        std::fill(sums, sums + (x1 - x0), A{});
+                        for (std::size_t k{0}; k != weights.size(); ++k)
+                        {
+                            const W wk{weights[k]};
+                            T* const in{from.row(y + k - anchor).data() + x0};
+                            for (std::size_t i{0}; i != x1 - x0; ++i)
+                                sums[i] += wk * in[i];
+                        }
+                        U* const out{to.row(y).data() + x0};
+                        for (std::size_t i{0}; i != x1 - x0; ++i)
+                            out[i] = static_cast<U>(sums[i]);
+                    });
+            });
+    }
+
+} // namespace detail
+
+// The neighborhood of an element, whose neighbors are at offsets
+// (`dx`, `dy`) from it.
+template <class T, class Border, bool Checked>
+class [[nodiscard]] neighborhood
+{
+    plane_view<const T> v;
+    const Border* b;
+    point2d<std::size_t> center;
+
+public:
+    constexpr neighborhood(
+        const plane_view<const T> v, const Border& b,
+        const point2d<std::size_t> center) noexcept
+      : v{v}, b{&b}, center{center}
+    {
+    }
+
+    [[nodiscard]] constexpr point2d<std::size_t> point() const noexcept
+    {
+        return center;
+    }
+
+    [[nodiscard]] constexpr T
+    operator()(const std::ptrdiff_t dx, const std::ptrdiff_t dy) const
+    {
+        if constexpr (Checked)
+            return detail::border_at(
+                *b, v, std::ptrdiff_t(center.x()) + dx,
+                std::ptrdiff_t(center.y()) + dy);
+        else
+            return v.row(std::size_t(std::ptrdiff_t(center.y()) + dy))
+                [std::size_t(std::ptrdiff_t(center.x()) + dx)];
+    }
+};
+
+// Assigns `f(n)` to each element of `to`, where `n` is the `neighborhood`
+// of the element of `from` at the same point, with neighbors up to
+// `radius` elements away in x and y. `f` takes its argument as `auto`, as
+// edges and the interior use different types of neighborhoods.
+template <
+    detail::viewable_plane From, detail::viewable_plane To, class F,
+    class Border = border::clamp>
+void stencil(
+    From&& from, To&& to, const std::size_t radius, const F f,
+    const Border& b = {}, thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    using T = typename decltype(src)::value_type;
+    using U = typename decltype(dst)::element_type;
+    assert(src.size() == dst.size());
+    const plane_view<const T> in{src};
+    const std::size_t side{2 * radius + 1};
+    par::detail::for_each_band(
+        pool, {pool, src.size(), sizeof(T) * side * side},
+        [&](std::size_t, const std::size_t first, const std::size_t last) {
+            detail::for_each_region(
+                src.size(), {radius, radius, radius, radius}, first, last,
+                [&](const std::size_t x, const std::size_t y) {
+                    const auto pt{abscissa{x} + ordinate{y}};
+                    dst[pt] = static_cast<U>(
+                        f(neighborhood<T, Border, true>{in, b, pt}));
+                },
+                [&](const std::size_t y, const std::size_t x0,
+                    const std::size_t x1) {
+                    using unchecked = neighborhood<T, Border, false>;
+                    const std::span<U> out{dst.row(y)};
+                    for (std::size_t x{x0}; x != x1; ++x)
+                        out[x] = static_cast<U>(f(unchecked{
+                            in, b, abscissa{x} + ordinate{y}}));
+                });
+        });
+}
+
+// Assigns to each element of `to` the sum of the elements of `from`
+// around the same point, weighted by `kernel`. The center of `kernel`
+// applies to the element at that point, and `kernel` is not flipped.
+// Sums are accumulated in the type of a weight times an element.
+template <
+    detail::viewable_plane From, detail::viewable_plane To, class W,
+    class Allocator, class Border = border::clamp>
+void convolve(
+    From&& from, To&& to, const plane<W, Allocator>& kernel,
+    const Border& b = {}, thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    using T = typename decltype(src)::element_type;
+    using U = typename decltype(dst)::element_type;
+    using A = detail::accumulator_t<std::remove_cv_t<T>, W>;
+    assert(src.size() == dst.size());
+    const size2d<std::size_t> ks{kernel.size()};
+    assert(to1d(ks) != 0);
+    const auto anchor{abscissa{ks.w() / 2} + ordinate{ks.h() / 2}};
+    const point2d<std::ptrdiff_t> off = anchor;
+    const detail::reach r{
+        anchor.x(), ks.w() - 1 - anchor.x(), anchor.y(),
+        ks.h() - 1 - anchor.y()};
+    const plane_view<const W> weights{kernel};
+    par::detail::for_each_band(
+        pool, {pool, src.size(), sizeof(T) * to1d(ks)},
+        [&](std::size_t, const std::size_t first, const std::size_t last) {
+            std::vector<A> acc(src.size().w());
+            detail::for_each_region(
+                src.size(), r, first, last,
+                [&](const std::size_t x, const std::size_t y) {
+                    A sum{};
+                    for (std::size_t ky{0}; ky != ks.h(); ++ky)
+                        for (std::size_t kx{0}; kx != ks.w(); ++kx)
+                            sum += weights[abscissa{kx} + ordinate{ky}] *
+                                   detail::border_at(
+                                       b, src,
+                                       std::ptrdiff_t(x + kx) - off.x(),
+                                       std::ptrdiff_t(y + ky) - off.y());
+                    dst[abscissa{x} + ordinate{y}] = static_cast<U>(sum);
+                },
+                [&](const std::size_t y, const std::size_t x0,
+                    const std::size_t x1) {
+                    A* const sums{acc.data() + x0};
+                    std::fill(sums, sums + (x1 - x0), A{});
+                    for (std::size_t ky{0}; ky != ks.h(); ++ky)
+                    {
+                        const std::span<const W> wy{weights.row(ky)};
+                        T* const row{src.row(y + ky - anchor.y()).data()};
+                        for (std::size_t kx{0}; kx != ks.w(); ++kx)
+                        {
+                            const W wk{wy[kx]};
+                            T* const in{row + (x0 + kx - anchor.x())};
+                            for (std::size_t i{0}; i != x1 - x0; ++i)
+                                sums[i] += wk * in[i];
+                        }
+                    }
+                    U* const out{dst.row(y).data() + x0};
+                    for (std::size_t i{0}; i != x1 - x0; ++i)
+                        out[i] = static_cast<U>(sums[i]);
+                });
+        });
+}
+
+// `convolve` with the kernel whose element at (x, y) is `kx[x] * ky[y]`,
+// as a pass along x into a plane of sums followed by a pass along y.
+// Costs `kx.size() + ky.size()` operations per element instead of their
+// product.
+template <
+    detail::viewable_plane From, detail::viewable_plane To, class W,
+    std::size_t NX, std::size_t NY, class Border = border::clamp>
+void convolve_separable(
+    From&& from, To&& to, const std::array<W, NX>& kx,
+    const std::array<W, NY>& ky, const Border& b = {},
+    thread_pool& pool = default_thread_pool())
+{
+    const plane_view src{std::forward<From>(from)};
+    const plane_view dst{std::forward<To>(to)};
+    using T = typename decltype(src)::value_type;
+    using A = detail::accumulator_t<T, W>;
+    static_assert(NX != 0 && NY != 0);
+    assert(src.size() == dst.size());
+    if (to1d(src.size()) == 0)
+        return;
+    plane<A> sums{src.size(), for_overwrite};
+    detail::correlate_rows(
+        src, plane_view<A>{sums}, std::span{kx}, NX / 2, b, pool);
+    const plane_view<const A> rows{sums};
+    if constexpr (detail::is_constant_border_v<Border>)
+    {
+        // Outside the plane, the first pass would have summed constants.
+        A edge{};
+        for (const W w : kx)
+            edge += w * static_cast<T>(b.value);
+        detail::correlate_columns(
+            rows, dst, std::span{ky}, NY / 2, border::constant<A>{edge}, pool);
+    }
+    else
+        detail::correlate_columns(rows, dst, std::span{ky}, NY / 2, b, pool);
+}
+
+} // namespace jge
+
+#endif // JGE_STENCIL_HPP
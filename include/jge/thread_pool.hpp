@@ -0,0 +1,158 @@
+#ifndef JGE_THREAD_POOL_HPP
+#define JGE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace jge
+{
+// A fixed set of threads that run the tasks of one job at a time.
+// The thread that runs a job works on it too, so a pool of `n` threads
+// starts `n - 1` of its own.
+class [[nodiscard]] thread_pool
+{
+    // The job being run, as `call(callable, i)` for each task `i`.
+    void (*call)(const void*, std::size_t){};
+    const void* callable{};
+    std::size_t tasks{};
+    std::atomic<std::size_t> next{};
+
+    std::size_t busy{};
+    std::uint64_t generation{};
+    std::exception_ptr error;
+    bool stopping{false};
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    std::mutex run_mutex;
+    std::vector<std::jthread> workers;
+
+    // The pool whose job the current thread is working on.
+    static inline thread_local const thread_pool* working_on{};
+
+    // Runs tasks of the current job until none is left.
+    void execute() noexcept
+    {
+        const thread_pool* const outer{std::exchange(working_on, this)};
+        for (std::size_t i; (i = next.fetch_add(1)) < tasks;)
+        {
+            try
+            {
+                call(callable, i);
+            }
+            catch (...)
+            {
+                const std::scoped_lock lock{mutex};
+                if (!error)
+                    error = std::current_exception();
+                next = tasks;
+            }
+        }
+        working_on = outer;
+    }
+
+    void work()
+    {
+        std::uint64_t seen{0};
+        std::unique_lock lock{mutex};
+        for (;;)
+        {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            if (call == nullptr)
+                continue;
+            ++busy;
+            lock.unlock();
+            execute();
+            lock.lock();
+            if (--busy == 0)
+                finished.notify_one();
+        }
+    }
+
+public:
+    explicit thread_pool(
+        const std::size_t threads = std::max(
+            std::thread::hardware_concurrency(), 1u))
+    {
+        workers.reserve(std::max(threads, std::size_t{1}) - 1);
+        for (std::size_t i{1}; i < threads; ++i)
+            workers.emplace_back([this] { work(); });
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            const std::scoped_lock lock{mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+    }
+
+    // The number of threads that run a job, counting the caller's.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return workers.size() + 1;
+    }
+
+    // Calls `f(i)` for each `i` in [0, `n`), concurrently, and returns when
+    // all calls have returned. If a call throws, the remaining tasks are
+    // skipped and the first exception is rethrown. Jobs run from within a
+    // task of this pool run serially on the calling thread.
+    template <class F>
+    void run(const std::size_t n, const F& f)
+    {
+        if (n == 0)
+            return;
+        if (workers.empty() || n == 1 || working_on == this)
+        {
+            for (std::size_t i{0}; i != n; ++i)
+                f(i);
+            return;
+        }
+        const std::scoped_lock serial{run_mutex};
+        {
+            const std::scoped_lock lock{mutex};
+            call = [](const void* const c, const std::size_t i) {
+                (*static_cast<const F*>(c))(i);
+            };
+            callable = &f;
+            tasks    = n;
+            next     = 0;
+            ++generation;
+        }
+        wake.notify_all();
+        execute();
+        std::unique_lock lock{mutex};
+        finished.wait(lock, [&] { return busy == 0; });
+        call = nullptr;
+        if (error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+};
+
+// The pool used by the `jge::par` algorithms when none is given, with a
+// thread per hardware thread.
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+} // namespace jge
+
+#endif // JGE_THREAD_POOL_HPP
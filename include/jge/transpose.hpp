@@ -0,0 +1,222 @@
+#ifndef JGE_TRANSPOSE_HPP
+#define JGE_TRANSPOSE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane_view.hpp>
+
+// Transposition, rotation and mirroring of planes and plane views.
+// Rotations are clockwise as displayed, with the y axis pointing down.
+// The two-argument forms write the result to another plane of the
+// resulting size, which must not overlap the source. The one-argument forms
+// work in place.
+
+namespace jge
+{
+namespace detail
+{
+    // Transposing kernels read `transpose_rows` rows at a time, each for
+    // `transpose_columns<T>` elements, so that each column written is a run
+    // of `transpose_rows` contiguous elements while the rows read stay in
+    // cache. Taller blocks measured faster than square ones.
+    inline constexpr std::size_t transpose_rows{128};
+
+    template <class T>
+    inline constexpr std::size_t transpose_columns{
+        std::max(std::size_t{8}, std::size_t{128} / sizeof(T))};
+
+    // The side of the square blocks that in-place transposition swaps.
+    template <class T>
+    inline constexpr std::size_t swap_block{
+        std::max(std::size_t{4}, std::size_t{32} / sizeof(T))};
+
+    // Assigns each element (x, y) of `from` to `to[x * x_step + y * y_step]`,
+    // in blocks.
+    template <class T, class U>
+    constexpr void blocked_transpose(
+        const plane_view<T> from, U* const to, const std::ptrdiff_t x_step,
+        const std::ptrdiff_t y_step)
+    {
+        constexpr std::size_t rows{transpose_rows};
+        constexpr std::size_t columns{transpose_columns<U>};
+        const std::size_t w{from.size().w()};
+        const std::size_t h{from.size().h()};
+        const std::size_t stride{from.row_stride()};
+        T* const first{from.data()};
+        for (std::size_t by{0}; by < h; by += rows)
+            for (std::size_t bx{0}; bx < w; bx += columns)
+            {
+                const std::size_t ey{std::min(by + rows, h)};
+                const std::size_t ex{std::min(bx + columns, w)};
+                for (std::size_t x{bx}; x != ex; ++x)
+                {
+                    U* const out{to + static_cast<std::ptrdiff_t>(x) * x_step};
+                    for (std::size_t y{by}; y != ey; ++y)
+                        out[static_cast<std::ptrdiff_t>(y) * y_step] =
+                            first[y * stride + x];
+                }
+            }
+    }
+
+    template <class From, class To>
+    constexpr auto transposed_views(From&& from, To&& to) noexcept
+    {
+        const plane_view f{std::forward<From>(from)};
+        const plane_view t{std::forward<To>(to)};
+        assert(t.size().w() == f.size().h() && t.size().h() == f.size().w());
+        return std::pair{f, t};
+    }
+
+    template <class From, class To>
+    constexpr auto same_size_views(From&& from, To&& to) noexcept
+    {
+        const plane_view f{std::forward<From>(from)};
+        const plane_view t{std::forward<To>(to)};
+        assert(t.size() == f.size());
+        return std::pair{f, t};
+    }
+
+} // namespace detail
+
+// Assigns `from[x, y]` to `to[y, x]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void transpose(From&& from, To&& to)
+{
+    const auto [f, t]{detail::transposed_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    const auto ts{static_cast<std::ptrdiff_t>(t.row_stride())};
+    detail::blocked_transpose(f, t.data(), ts, 1);
+}
+
+// Assigns `from[x, y]` to `to[h - 1 - y, x]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void rotate90(From&& from, To&& to)
+{
+    const auto [f, t]{detail::transposed_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    if (to1d(f.size()) == 0)
+        return;
+    const auto ts{static_cast<std::ptrdiff_t>(t.row_stride())};
+    detail::blocked_transpose(f, t.data() + (f.size().h() - 1), ts, -1);
+}
+
+// Assigns `from[x, y]` to `to[y, w - 1 - x]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void rotate270(From&& from, To&& to)
+{
+    const auto [f, t]{detail::transposed_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    if (to1d(f.size()) == 0)
+        return;
+    const auto ts{static_cast<std::ptrdiff_t>(t.row_stride())};
+    detail::blocked_transpose(
+        f, t.data() + static_cast<std::ptrdiff_t>(f.size().w() - 1) * ts, -ts,
+        1);
+}
+
+// Assigns `from[x, y]` to `to[w - 1 - x, h - 1 - y]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void rotate180(From&& from, To&& to)
+{
+    const auto [f, t]{detail::same_size_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    const std::size_t h{f.size().h()};
+    for (std::size_t y{0}; y != h; ++y)
+        std::ranges::reverse_copy(f.row(y), t.row(h - 1 - y).begin());
+}
+
+// Assigns `from[x, y]` to `to[w - 1 - x, y]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void flip_x(From&& from, To&& to)
+{
+    const auto [f, t]{detail::same_size_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    for (std::size_t y{0}; y != f.size().h(); ++y)
+        std::ranges::reverse_copy(f.row(y), t.row(y).begin());
+}
+
+// Assigns `from[x, y]` to `to[x, h - 1 - y]`.
+template <detail::viewable_plane From, detail::viewable_plane To>
+constexpr void flip_y(From&& from, To&& to)
+{
+    const auto [f, t]{detail::same_size_views(
+        std::forward<From>(from), std::forward<To>(to))};
+    const std::size_t h{f.size().h()};
+    for (std::size_t y{0}; y != h; ++y)
+        std::ranges::copy(f.row(y), t.row(h - 1 - y).begin());
+}
+
+// In place.
+
+template <detail::viewable_plane P>
+constexpr void flip_x(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    for (std::size_t y{0}; y != v.size().h(); ++y)
+        std::ranges::reverse(v.row(y));
+}
+
+template <detail::viewable_plane P>
+constexpr void flip_y(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    const std::size_t h{v.size().h()};
+    for (std::size_t y{0}; y != h / 2; ++y)
+        std::ranges::swap_ranges(v.row(y), v.row(h - 1 - y));
+}
+
+template <detail::viewable_plane P>
+constexpr void rotate180(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    flip_x(v);
+    flip_y(v);
+}
+
+// Requires a square plane.
+template <detail::viewable_plane P>
+constexpr void transpose(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    assert(v.size().w() == v.size().h());
+    using T = typename decltype(v)::element_type;
+    constexpr std::size_t block{detail::swap_block<T>};
+    const std::size_t n{v.size().w()};
+    const std::size_t s{v.row_stride()};
+    T* const first{v.data()};
+    // Swaps each block above the diagonal with its mirror below it.
+    for (std::size_t by{0}; by < n; by += block)
+        for (std::size_t bx{by}; bx < n; bx += block)
+            for (std::size_t y{by}; y != std::min(by + block, n); ++y)
+                for (std::size_t x{std::max(bx, y + 1)};
+                     x < std::min(bx + block, n); ++x)
+                {
+                    using std::swap;
+                    swap(first[y * s + x], first[x * s + y]);
+                }
+}
+
+// Requires a square plane.
+template <detail::viewable_plane P>
+constexpr void rotate90(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    transpose(v);
+    flip_x(v);
+}
+
+// Requires a square plane.
+template <detail::viewable_plane P>
+constexpr void rotate270(P&& p)
+{
+    const plane_view v{std::forward<P>(p)};
+    transpose(v);
+    flip_y(v);
+}
+
+} // namespace jge
+
+#endif // JGE_TRANSPOSE_HPP
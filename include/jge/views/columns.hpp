@@ -0,0 +1,37 @@
+#ifndef JGE_VIEWS_COLUMNS_HPP
+#define JGE_VIEWS_COLUMNS_HPP
+
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <jge/plane_view.hpp>
+#include <jge/views/rows.hpp>
+
+namespace jge
+{
+namespace views
+{
+    // The columns of a plane, from left to right, each as a range of its
+    // elements from top to bottom. The elements of a column are
+    // `row_stride()` elements apart, so prefer `views::rows` for inner
+    // loops.
+    inline constexpr auto columns =
+        []<detail::viewable_plane P>(P&& p) noexcept {
+        const plane_view v{std::forward<P>(p)};
+        using T = typename decltype(v)::element_type;
+        return std::views::iota(std::size_t{0}, v.size().w()) |
+               std::views::transform([v](const std::size_t x) noexcept {
+                   return std::views::iota(std::size_t{0}, v.size().h()) |
+                          std::views::transform(
+                              [first{v.data() + x}, stride{v.row_stride()}](
+                                  const std::size_t y) noexcept -> T& {
+                                  return first[y * stride];
+                              });
+               });
+    };
+
+} // namespace views
+
+} // namespace jge
+
+#endif // JGE_VIEWS_COLUMNS_HPP
@@ -0,0 +1,27 @@
+#ifndef JGE_VIEWS_ROWS_HPP
+#define JGE_VIEWS_ROWS_HPP
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <jge/plane_view.hpp>
+
+namespace jge
+{
+namespace views
+{
+    // The rows of a plane, from top to bottom, as `std::span`s.
+    inline constexpr auto rows =
+        []<detail::viewable_plane P>(P&& p) noexcept {
+        const plane_view v{std::forward<P>(p)};
+        return std::views::iota(std::size_t{0}, v.size().h()) |
+               std::views::transform(
+                   [v](const std::size_t y) noexcept { return v.row(y); });
+    };
+
+} // namespace views
+
+} // namespace jge
+
+#endif // JGE_VIEWS_ROWS_HPP
@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <random>
+#include <utility>
+#include <jge/bit_plane.hpp>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(std::regular<jge::bit_plane>);
+
+using point    = jge::bit_plane::point_type;
+using subplane = jge::bit_plane::subplane_type;
+
+point at(const std::size_t x, const std::size_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+// Rows of three words, the last one partial.
+const jge::size2d sz{
+    jge::width{std::size_t{150}} + jge::height{std::size_t{7}}};
+
+jge::plane<bool>
+random_plane(std::mt19937& engine, const jge::size2d<std::size_t> sz)
+{
+    jge::plane<bool> p{sz, jge::value_initialize};
+    std::bernoulli_distribution bit{0.3};
+    for (bool& b : to1d(p))
+        b = bit(engine);
+    return p;
+}
+
+subplane random_subplane(std::mt19937& engine)
+{
+    std::uniform_int_distribution<std::size_t> x{0, sz.w()};
+    std::uniform_int_distribution<std::size_t> y{0, sz.h()};
+    const std::size_t xs[]{x(engine), x(engine)};
+    const std::size_t ys[]{y(engine), y(engine)};
+    const auto [x0, x1] = std::minmax(xs[0], xs[1]);
+    const auto [y0, y1] = std::minmax(ys[0], ys[1]);
+    return {at(x0, y0), jge::width{x1 - x0} + jge::height{y1 - y0}};
+}
+
+void test_conversions()
+{
+    std::mt19937 engine{};
+    const jge::plane<bool> dense{random_plane(engine, sz)};
+    const jge::bit_plane b{dense};
+    assert(b.size() == sz);
+    assert(b.row(0).size() == 3);
+    assert(jge::plane<bool>{b} == dense);
+    for (std::size_t y{0}; y != sz.h(); ++y)
+        for (std::size_t x{0}; x != sz.w(); ++x)
+            assert(b[at(x, y)] == dense[at(x, y)]);
+
+    const jge::bit_plane il{{true, false, true}, {false, false, true}};
+    assert(il.size() == 3_w + 2_h);
+    assert(il[0_x + 0_y] && !il[1_x + 0_y] && il[2_x + 1_y]);
+    assert(il.count() == 3);
+
+    assert(jge::bit_plane{}.size() == jge::size2d<std::size_t>{});
+    assert(jge::bit_plane{}.none());
+}
+
+void test_elements()
+{
+    jge::bit_plane b{sz};
+    assert(b.none() && b.count() == 0);
+    b.set(at(149, 6));
+    b[at(64, 0)] = true;
+    assert(b.test(at(149, 6)) && b[at(64, 0)]);
+    assert(b.count() == 2);
+    b.flip(at(64, 0));
+    b.flip(at(63, 0));
+    assert(!b[at(64, 0)] && b[at(63, 0)]);
+    b[at(0, 1)] = std::as_const(b)[at(63, 0)];
+    assert(b[at(0, 1)]);
+    b.reset(at(63, 0));
+    assert(b.count() == 2);
+
+    // The padding of each row stays clear.
+    b.set();
+    assert(b.count() == to1d(sz));
+    assert(b == jge::bit_plane(sz, true));
+    b.flip();
+    assert(b.none());
+    assert((~b).count() == to1d(sz));
+    b.set(at(3, 3));
+    b.reset();
+    assert(b.none());
+}
+
+void test_subplanes()
+{
+    std::mt19937 engine{};
+    for (int i{0}; i != 200; ++i)
+    {
+        const jge::plane<bool> dense{random_plane(engine, sz)};
+        const subplane s{random_subplane(engine)};
+
+        std::size_t count{0};
+        std::optional<point> first;
+        for (std::size_t y{s.top_left.y()}; y != s.bottom_right().y(); ++y)
+            for (std::size_t x{s.top_left.x()}; x != s.bottom_right().x();
+                 ++x)
+                if (dense[at(x, y)])
+                {
+                    ++count;
+                    if (!first)
+                        first = at(x, y);
+                }
+
+        jge::bit_plane b{dense};
+        assert(b.count(s) == count);
+        assert(b.find_first(s) == first);
+
+        b.flip(s);
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+                assert(
+                    b[at(x, y)] == (dense[at(x, y)] != contains(s, at(x, y))));
+        b.set(s);
+        assert(b.count(s) == to1d(s.size));
+        b.reset(s);
+        assert(b.count(s) == 0);
+        assert(b.count() == jge::bit_plane{dense}.count() - count);
+    }
+
+    jge::bit_plane b{sz};
+    assert(b.find_first() == std::nullopt);
+    b.set(at(70, 4));
+    b.set(at(2, 5));
+    assert(b.find_first() == at(70, 4));
+    const jge::height one_row{std::size_t{1}};
+    assert(
+        b.find_first({at(71, 4), jge::width{sz.w() - 71} + one_row}) ==
+        std::nullopt);
+    assert(b.find_first({at(0, 5), sz.w + one_row}) == at(2, 5));
+}
+
+template <class Op>
+void test_assign_at(const Op op)
+{
+    std::mt19937 engine{};
+    for (int i{0}; i != 200; ++i)
+    {
+        const jge::plane<bool> dense{random_plane(engine, sz)};
+        const subplane s{random_subplane(engine)};
+        if (to1d(s.size) == 0)
+        {
+            jge::bit_plane b{dense};
+            b.assign_at(s.top_left, jge::bit_plane{s.size}, op);
+            assert(b == jge::bit_plane{dense});
+            continue;
+        }
+        const jge::plane<bool> other{random_plane(engine, s.size)};
+
+        jge::bit_plane b{dense};
+        b.assign_at(s.top_left, jge::bit_plane{other}, op);
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const point pt{at(x, y)};
+                const bool expected{
+                    contains(s, pt)
+                        ? static_cast<bool>(
+                              op(dense[pt],
+                                 other[at(x - s.top_left.x(),
+                                          y - s.top_left.y())]))
+                        : dense[pt]};
+                assert(b[pt] == expected);
+            }
+    }
+}
+
+void test_whole_plane()
+{
+    std::mt19937 engine{};
+    const jge::plane<bool> l{random_plane(engine, sz)};
+    const jge::plane<bool> r{random_plane(engine, sz)};
+    const jge::bit_plane bl{l};
+    const jge::bit_plane br{r};
+    const jge::bit_plane band{bl & br};
+    const jge::bit_plane bor{bl | br};
+    const jge::bit_plane bxor{bl ^ br};
+    const jge::bit_plane bnot{~bl};
+    for (std::size_t y{0}; y != sz.h(); ++y)
+        for (std::size_t x{0}; x != sz.w(); ++x)
+        {
+            const point pt{at(x, y)};
+            assert(band[pt] == (l[pt] && r[pt]));
+            assert(bor[pt] == (l[pt] || r[pt]));
+            assert(bxor[pt] == (l[pt] != r[pt]));
+            assert(bnot[pt] == !l[pt]);
+        }
+    assert(bnot.count() == to1d(sz) - bl.count());
+}
+
+void test_shifted()
+{
+    std::mt19937 engine{};
+    const jge::plane<bool> dense{random_plane(engine, sz)};
+    const jge::bit_plane b{dense};
+    for (const std::ptrdiff_t dx :
+         {-200, -130, -64, -5, 0, 1, 63, 64, 100, 150})
+        for (const std::ptrdiff_t dy : {-7, -2, 0, 3, 8})
+        {
+            const jge::bit_plane s{b.shifted(dx, dy)};
+            assert(s.size() == sz);
+            std::size_t count{0};
+            for (std::size_t y{0}; y != sz.h(); ++y)
+                for (std::size_t x{0}; x != sz.w(); ++x)
+                {
+                    const auto fx{static_cast<std::ptrdiff_t>(x) - dx};
+                    const auto fy{static_cast<std::ptrdiff_t>(y) - dy};
+                    const bool inside{
+                        0 <= fx && fx < static_cast<std::ptrdiff_t>(sz.w()) &&
+                        0 <= fy && fy < static_cast<std::ptrdiff_t>(sz.h())};
+                    const bool expected{
+                        inside && dense[at(static_cast<std::size_t>(fx),
+                                           static_cast<std::size_t>(fy))]};
+                    assert(s[at(x, y)] == expected);
+                    count += expected;
+                }
+            assert(s.count() == count);
+        }
+}
+
+int main()
+{
+    test_conversions();
+    test_elements();
+    test_subplanes();
+    test_assign_at(std::bit_and<>{});
+    test_assign_at(std::bit_or<>{});
+    test_assign_at(std::bit_xor<>{});
+    test_whole_plane();
+    test_shifted();
+}
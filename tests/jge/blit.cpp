@@ -0,0 +1,194 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <jge/blit.hpp>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+constexpr jge::point2d<std::ptrdiff_t>
+at(const std::ptrdiff_t x, const std::ptrdiff_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+constexpr jge::subplane<std::ptrdiff_t> region(
+    const std::ptrdiff_t x, const std::ptrdiff_t y, const std::ptrdiff_t w,
+    const std::ptrdiff_t h)
+{
+    return {at(x, y), jge::width{w} + jge::height{h}};
+}
+
+constexpr void test()
+{
+    const jge::plane<int> src{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+    {
+        jge::plane<int> dst{4_w + 3_h, jge::value_initialize};
+        jge::blit(src, region(1, 0, 2, 2), dst, at(2, 1));
+        assert((dst == jge::plane<int>{
+                           {0, 0, 0, 0}, {0, 0, 2, 3}, {0, 0, 5, 6}}));
+    }
+
+    // Clipped against the source and the destination.
+    {
+        jge::plane<int> dst{3_w + 3_h, jge::value_initialize};
+        jge::blit(src, region(-1, -1, 3, 3), dst, at(-1, 1));
+        assert((dst == jge::plane<int>{{0, 0, 0}, {0, 0, 0}, {1, 2, 0}}));
+
+        jge::blit(src, region(1, 1, 9, 9), dst, at(0, 0));
+        assert((dst == jge::plane<int>{{5, 6, 0}, {8, 9, 0}, {1, 2, 0}}));
+
+        const jge::plane<int> before{dst};
+        for (const auto to : {at(3, 0), at(0, 3), at(-2, 0), at(0, -2)})
+            jge::blit(src, region(0, 0, 2, 2), dst, to);
+        jge::blit(src, region(3, 0, 1, 1), dst, at(0, 0));
+        jge::blit(src, region(0, 0, 0, 2), dst, at(0, 0));
+        assert(dst == before);
+    }
+
+    // Overlapping regions of the same plane.
+    {
+        jge::plane<int> p{src};
+        jge::blit(p, region(0, 0, 2, 2), p, at(1, 1));
+        assert((p == jge::plane<int>{{1, 2, 3}, {4, 1, 2}, {7, 4, 5}}));
+        p = src;
+        jge::blit(p, region(1, 1, 2, 2), p, at(0, 0));
+        assert((p == jge::plane<int>{{5, 6, 3}, {8, 9, 6}, {7, 8, 9}}));
+        p = src;
+        jge::blit(p, region(0, 0, 2, 3), p, at(1, 0));
+        assert((p == jge::plane<int>{{1, 1, 2}, {4, 4, 5}, {7, 7, 8}}));
+        p = src;
+        jge::blit(p, region(1, 0, 2, 3), p, at(0, 0));
+        assert((p == jge::plane<int>{{2, 3, 3}, {5, 6, 6}, {8, 9, 9}}));
+    }
+
+    // Between views, and with conversion.
+    {
+        jge::plane<long> dst{4_w + 4_h, jge::value_initialize};
+        const jge::plane_view to{dst, {1_x + 1_y, 2_w + 2_h}};
+        jge::blit(jge::plane_view{src}, region(0, 0, 3, 3), to, at(0, 0));
+        assert((dst == jge::plane<long>{
+                           {0, 0, 0, 0}, {0, 1, 2, 0}, {0, 4, 5, 0},
+                           {0, 0, 0, 0}}));
+    }
+
+    // A layer of tiles from a tileset.
+    {
+        const jge::plane<int> tileset{{1, 1, 2, 2}, {1, 1, 2, 2}};
+        jge::plane<int> layer{5_w + 2_h, jge::value_initialize};
+        const std::array<jge::blit_command, 3> commands{{
+            {region(2, 0, 2, 2), at(0, 0)},
+            {region(0, 0, 2, 2), at(2, 0)},
+            {region(2, 0, 2, 2), at(4, 0)},
+        }};
+        jge::blit(tileset, commands, layer);
+        assert((layer == jge::plane<int>{
+                             {2, 2, 1, 1, 2}, {2, 2, 1, 1, 2}}));
+    }
+
+    {
+        jge::plane<int> p{4_w + 3_h, jge::value_initialize};
+        jge::fill(p, region(1, 1, 2, 5), 7);
+        jge::fill(p, region(-1, -1, 2, 2), 3);
+        jge::fill(p, region(4, 0, 1, 1), 9);
+        assert((p == jge::plane<int>{
+                         {3, 0, 0, 0}, {0, 7, 7, 0}, {0, 7, 7, 0}}));
+        const jge::plane_view v{p, {2_x + 0_y, 2_w + 3_h}};
+        jge::fill(v, region(1, 0, 1, 3), 1);
+        assert((p == jge::plane<int>{
+                         {3, 0, 0, 1}, {0, 7, 7, 1}, {0, 7, 7, 1}}));
+    }
+
+    {
+        const jge::plane<std::string> a{{"a", "b"}, {"c", "d"}};
+        const jge::plane<std::string> b{{"e"}, {"f"}};
+        assert((jge::stitch_x(a, b, a) == jge::plane<std::string>{
+                                             {"a", "b", "e", "a", "b"},
+                                             {"c", "d", "f", "c", "d"}}));
+        const jge::plane<std::string> c{{"g", "h"}};
+        assert((jge::stitch_y(c, a) == jge::plane<std::string>{
+                                          {"g", "h"}, {"a", "b"}, {"c", "d"}}));
+        assert((jge::stitch_y(jge::plane_view{a, {0_x + 1_y, 2_w + 1_h}}, c) ==
+                jge::plane<std::string>{{"c", "d"}, {"g", "h"}}));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+// The `memmove` and `memset` paths, against the element-wise definitions.
+void test_bytes()
+{
+    const auto sz{jge::width{std::size_t{37}} + jge::height{std::size_t{29}}};
+    jge::plane<std::uint8_t> p{sz, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(sz); ++i)
+        to1d(p)[i] = static_cast<std::uint8_t>(i * 7);
+    const jge::plane<std::uint8_t> original{p};
+
+    for (const auto to : {at(-5, 3), at(4, -2), at(11, 9), at(0, 0)})
+    {
+        p = original;
+        const auto r{region(2, 1, 30, 25)};
+        jge::blit(p, r, p, to);
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const auto pt{jge::abscissa{x} + jge::ordinate{y}};
+                const auto sx{static_cast<std::ptrdiff_t>(x) - to.x() + 2};
+                const auto sy{static_cast<std::ptrdiff_t>(y) - to.y() + 1};
+                const bool inside{2 <= sx && sx < 32 && 1 <= sy && sy < 26};
+                assert(
+                    p[pt] ==
+                    (inside ? original[jge::abscissa{std::size_t(sx)} +
+                                       jge::ordinate{std::size_t(sy)}]
+                            : original[pt]));
+            }
+    }
+
+    p = original;
+    jge::fill(p, region(3, 4, 100, 5), std::uint8_t{0xA5});
+    for (std::size_t y{0}; y != sz.h(); ++y)
+        for (std::size_t x{0}; x != sz.w(); ++x)
+        {
+            const auto pt{jge::abscissa{x} + jge::ordinate{y}};
+            const bool inside{3 <= x && 4 <= y && y < 9};
+            assert(p[pt] == (inside ? 0xA5 : original[pt]));
+        }
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+    test_bytes();
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <jge/buffered_plane.hpp>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(!std::copyable<jge::buffered_plane<int>>);
+
+void test_handoff(const jge::buffer_sync sync)
+{
+    jge::buffered_plane<int> p{{{0, 0}, {0, 0}, {0, 0}}, sync};
+    assert(p.size() == 2_w + 3_h);
+    assert(!p.has_new_frame());
+    assert((p.acquire() == jge::plane<int>{{0, 0}, {0, 0}, {0, 0}}));
+
+    p[0_x + 0_y] = 1;
+    p.row(2)[1] = 2;
+    assert((p.front()[0_x + 0_y] == 0));
+    p.publish();
+    assert(p.has_new_frame());
+    assert((p.front()[0_x + 0_y] == 0));
+    assert((p.acquire() == jge::plane<int>{{1, 0}, {0, 0}, {0, 2}}));
+    assert(!p.has_new_frame());
+
+    if (sync == jge::buffer_sync::none)
+        return;
+
+    // The back buffer continues from the published frame.
+    assert((p[0_x + 0_y] == 1));
+    p[1_x + 1_y] = 3;
+    p.publish();
+    p[0_x + 0_y] = 4;
+    p.publish();
+    assert((p.acquire() == jge::plane<int>{{4, 0}, {0, 3}, {0, 2}}));
+    p.row(1)[0] = 5;
+    p.publish();
+    p.back()[1_x + 0_y] = 6;
+    p.publish();
+    assert((p.acquire() == jge::plane<int>{{4, 6}, {5, 3}, {0, 2}}));
+    p.publish();
+    assert((p.acquire() == jge::plane<int>{{4, 6}, {5, 3}, {0, 2}}));
+}
+
+// Checks that the reader only ever sees whole frames while the writer
+// publishes concurrently.
+void test_concurrency(const jge::buffer_sync sync)
+{
+    constexpr int frames{20'000};
+    jge::buffered_plane<int> p{16_w + 16_h, jge::value_initialize, sync};
+    std::jthread writer{[&] {
+        for (int f{1}; f <= frames; ++f)
+        {
+            for (std::size_t y{0}; y != p.size().h(); ++y)
+                std::ranges::fill(p.row(y), f);
+            p.publish();
+        }
+    }};
+    int last{0};
+    while (last != frames)
+    {
+        const auto& front{p.acquire()};
+        const int f{front[0_x + 0_y]};
+        assert(f >= last);
+        assert(std::ranges::all_of(to1d(front), [f](int e) { return e == f; }));
+        last = f;
+    }
+}
+
+int main()
+{
+    test_handoff(jge::buffer_sync::none);
+    test_handoff(jge::buffer_sync::all_rows);
+    test_handoff(jge::buffer_sync::dirty_rows);
+    test_concurrency(jge::buffer_sync::none);
+    test_concurrency(jge::buffer_sync::all_rows);
+    test_concurrency(jge::buffer_sync::dirty_rows);
+}
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/chunked_plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{static_cast<std::ptrdiff_t>(w)};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{static_cast<std::ptrdiff_t>(h)};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{static_cast<std::ptrdiff_t>(x)};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{static_cast<std::ptrdiff_t>(y)};
+}
+
+using chunked_plane_4x2 = jge::chunked_plane<int, 4, 2>;
+
+static_assert(std::copyable<chunked_plane_4x2>);
+static_assert(chunked_plane_4x2::chunk_size == 4_w + 2_h);
+static_assert(chunked_plane_4x2::chunk_origin(0_x + 0_y) == 0_x + 0_y);
+static_assert(chunked_plane_4x2::chunk_origin(5_x + 3_y) == 4_x + 2_y);
+static_assert(chunked_plane_4x2::chunk_origin(-1_x + -1_y) == -4_x + -2_y);
+static_assert(chunked_plane_4x2::chunk_origin(-4_x + -3_y) == -4_x + -4_y);
+static_assert(chunked_plane_4x2::chunk_origin(-5_x + 1_y) == -8_x + 0_y);
+
+int main()
+{
+    {
+        const chunked_plane_4x2 p;
+        assert(p.chunk_count() == 0);
+        assert((p[1000_x + -1000_y] == 0));
+        assert(p.find_chunk(0_x + 0_y) == nullptr);
+        assert(p.bounds() == jge::subplane<std::ptrdiff_t>{});
+        assert(std::ranges::empty(p.chunks()));
+    }
+    {
+        chunked_plane_4x2 p{-1};
+        assert(p.background() == -1);
+        assert((p[0_x + 0_y] == -1));
+        p.touch(-1_x + -1_y) = 7;
+        assert(p.chunk_count() == 1);
+        assert((p[-1_x + -1_y] == 7));
+        assert((p[-2_x + -1_y] == -1));
+        assert((p[0_x + 0_y] == -1));
+        assert(p.find_chunk(-4_x + -2_y) == p.find_chunk(-1_x + -1_y));
+        assert((std::ranges::count(to1d(*p.find_chunk(-1_x + -1_y)), -1) == 7));
+
+        p.touch(9_x + 4_y) = 3;
+        assert(p.chunk_count() == 2);
+        assert((p.bounds() == jge::subplane{-4_x + -2_y, 16_w + 8_h}));
+        for (const auto& [origin, chunk] : p.chunks())
+            assert(origin == -4_x + -2_y || origin == 8_x + 4_y);
+
+        const chunked_plane_4x2 copy{p};
+        p.erase_chunk(-3_x + -2_y);
+        assert(p.chunk_count() == 1);
+        assert((p[-1_x + -1_y] == -1));
+        assert((copy[-1_x + -1_y] == 7));
+        p.clear();
+        assert(p.chunk_count() == 0);
+        assert((p[9_x + 4_y] == -1));
+    }
+    {
+        std::pmr::monotonic_buffer_resource mr;
+        jge::pmr::chunked_plane<int, 8> p{&mr};
+        p.touch(0_x + 0_y) = 1;
+        assert(p.get_allocator().resource() == &mr);
+        assert((std::as_const(p)[0_x + 0_y] == 1));
+    }
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/cow_plane.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+using cow_plane_2 = jge::cow_plane<int, 2>;
+
+static_assert(std::regular<cow_plane_2>);
+static_assert(std::ranges::input_range<decltype(to1d(cow_plane_2{}))>);
+
+// Snapshots read and released by another thread while the plane is written.
+void test_threads()
+{
+    jge::cow_plane<int, 4> p{64_w + 64_h, jge::value_initialize};
+    for (int i{1}; i != 9; ++i)
+    {
+        std::thread reader{[snapshot = p, i] {
+            assert(std::ranges::all_of(
+                to1d(snapshot), [&](const int e) { return e == i - 1; }));
+        }};
+        for (std::size_t y{0}; y != 64; ++y)
+            for (std::size_t x{0}; x != 64; ++x)
+                p[jge::abscissa{x} + jge::ordinate{y}] = i;
+        reader.join();
+    }
+    assert(p.shared_band_count() == 0);
+}
+
+int main()
+{
+    test_threads();
+    {
+        const cow_plane_2 p;
+        assert(p.size() == 0_w + 0_h);
+        assert(std::ranges::distance(to1d(p)) == 0);
+    }
+    {
+        cow_plane_2 p{{0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}};
+        assert(p.size() == 2_w + 5_h);
+        assert(std::ranges::equal(
+            to1d(p), std::array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+        assert(p.shared_band_count() == 0);
+
+        const cow_plane_2 snapshot{p};
+        assert(snapshot == p);
+        assert(p.shared_band_count() == 3);
+        assert((std::as_const(p)[1_x + 2_y] == 5));
+        assert(std::ranges::equal(std::as_const(p).row(4), std::array{8, 9}));
+        assert(p.shared_band_count() == 3);
+
+        p[1_x + 2_y] = -5;
+        assert(p.shared_band_count() == 2);
+        assert((p[1_x + 2_y] == -5));
+        assert((snapshot[1_x + 2_y] == 5));
+        assert(snapshot != p);
+
+        p.row(4)[0] = -8;
+        assert(p.shared_band_count() == 1);
+        assert((snapshot[0_x + 4_y] == 8));
+        assert(std::ranges::equal(
+            to1d(p), std::array{0, 1, 2, 3, 4, -5, 6, 7, -8, 9}));
+        assert(std::ranges::equal(
+            to1d(snapshot), std::array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+        const jge::plane<int> q{p};
+        assert(
+            (q == jge::plane<int>{{0, 1}, {2, 3}, {4, -5}, {6, 7}, {-8, 9}}));
+        assert(cow_plane_2{q} == p);
+    }
+    {
+        const jge::cow_plane<std::string> p{3_w + 20_h, jge::value_initialize};
+        jge::cow_plane<std::string> q{p};
+        q[2_x + 19_y] = "changed";
+        assert(q.shared_band_count() == 1);
+        assert(p[2_x + 19_y].empty());
+        assert(std::ranges::count(to1d(q), "changed") == 1);
+    }
+}
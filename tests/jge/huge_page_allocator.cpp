@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <jge/cartesian.hpp>
+#include <jge/huge_page_allocator.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+static_assert(std::same_as<
+              jge::huge_page_plane<int>,
+              jge::plane<int, jge::huge_page_allocator<int>>>);
+static_assert(std::is_nothrow_move_assignable_v<jge::huge_page_plane<int>>);
+
+constexpr void test()
+{
+    {
+        const jge::huge_page_plane<int> p{{0, 1}, {2, 3}};
+        assert(std::ranges::equal(to1d(p), std::array{0, 1, 2, 3}));
+        const jge::huge_page_plane<int> p2{p};
+        assert(p == p2);
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+void test_mapping()
+{
+    using allocator = jge::huge_page_allocator<std::uint16_t>;
+    {
+        allocator a;
+        const std::size_t n{allocator::threshold / sizeof(std::uint16_t) * 3};
+        std::uint16_t* const p{a.allocate(n)};
+        assert(
+            reinterpret_cast<std::uintptr_t>(p) % allocator::huge_page_size ==
+            0);
+        std::ranges::fill(std::span{p, n}, 7);
+        assert(p[n - 1] == 7);
+        a.deallocate(p, n);
+    }
+    {
+        // Sizes that would wrap when rounded to huge pages.
+        allocator a;
+        const std::size_t n{
+            std::numeric_limits<std::size_t>::max() / sizeof(std::uint16_t)};
+        for (const std::size_t m : {n, n - allocator::huge_page_size / 4})
+        {
+            bool threw{false};
+            try
+            {
+                a.deallocate(a.allocate(m), m);
+            }
+            catch (const std::bad_alloc&)
+            {
+                threw = true;
+            }
+            assert(threw);
+        }
+    }
+    {
+        allocator a;
+        std::uint16_t* const p{a.allocate(1)};
+        *p = 7;
+        a.deallocate(p, 1);
+    }
+    {
+        jge::huge_page_plane<std::uint16_t> p{
+            1024_w + 1024_h, jge::value_initialize};
+        assert(std::ranges::all_of(to1d(p), [](auto e) { return e == 0; }));
+        to1d(p).back() = 1;
+        const jge::huge_page_plane<std::uint16_t> p2{p};
+        assert(p == p2);
+    }
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+    test_mapping();
+}
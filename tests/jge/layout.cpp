@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <jge/cartesian.hpp>
+#include <jge/layout.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{std::size_t{w}};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{std::size_t{h}};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{std::size_t{x}};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{std::size_t{y}};
+}
+
+// Checks that `Layout` maps the points of `sz` to distinct storage indices,
+// and back.
+template <class Layout>
+constexpr void test_bijection(const jge::size2d<std::size_t> sz)
+{
+    const typename Layout::mapping m{sz};
+    const auto storage{m.storage_size()};
+    assert(storage.w() >= sz.w() && storage.h() >= sz.h());
+    std::size_t points{0};
+    for (std::size_t i{0}; i != to1d(storage); ++i)
+    {
+        const auto pt{m.to2d(i)};
+        assert(contains(storage, pt));
+        assert(m.to1d(pt) == i);
+        points += contains(sz, pt);
+    }
+    assert(points == to1d(sz));
+}
+
+template <class Layout>
+constexpr void test_layout()
+{
+    test_bijection<Layout>(0_w + 0_h);
+    test_bijection<Layout>(1_w + 1_h);
+    test_bijection<Layout>(3_w + 5_h);
+    test_bijection<Layout>(8_w + 8_h);
+    test_bijection<Layout>(16_w + 3_h);
+    test_bijection<Layout>(9_w + 17_h);
+}
+
+constexpr void test()
+{
+    test_layout<jge::layout_row_major>();
+    test_layout<jge::layout_tiled<1>>();
+    test_layout<jge::layout_tiled<4>>();
+    test_layout<jge::layout_tiled<3>>();
+    test_layout<jge::layout_morton>();
+
+    {
+        const jge::layout_row_major::mapping m{3_w + 2_h};
+        assert(m.storage_size() == 3_w + 2_h);
+        assert(m.to1d(1_x + 1_y) == 4);
+    }
+    {
+        const jge::layout_tiled<2>::mapping m{3_w + 3_h};
+        assert(m.storage_size() == 4_w + 4_h);
+        assert(m.to1d(0_x + 0_y) == 0);
+        assert(m.to1d(1_x + 0_y) == 1);
+        assert(m.to1d(0_x + 1_y) == 2);
+        assert(m.to1d(2_x + 0_y) == 4);
+        assert(m.to1d(0_x + 2_y) == 8);
+    }
+    {
+        const jge::layout_morton::mapping m{4_w + 3_h};
+        assert(m.storage_size() == 4_w + 4_h);
+        assert(m.to1d(1_x + 0_y) == 1);
+        assert(m.to1d(0_x + 1_y) == 2);
+        assert(m.to1d(1_x + 1_y) == 3);
+        assert(m.to1d(2_x + 0_y) == 4);
+        assert(m.to1d(3_x + 3_y) == 15);
+    }
+    {
+        const jge::layout_morton::mapping m{6_w + 2_h};
+        assert(m.storage_size() == 8_w + 2_h);
+        assert(m.to1d(1_x + 1_y) == 3);
+        assert(m.to1d(2_x + 0_y) == 4);
+        assert(m.to1d(7_x + 1_y) == 15);
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/layout.hpp>
+#include <jge/layout_plane.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{std::size_t{w}};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{std::size_t{h}};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{std::size_t{x}};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{std::size_t{y}};
+}
+
+static_assert(std::regular<jge::morton_plane<int>>);
+static_assert(std::regular<jge::tiled_plane<int>>);
+static_assert(std::is_nothrow_move_constructible_v<jge::morton_plane<int>>);
+static_assert(std::is_nothrow_move_assignable_v<jge::morton_plane<int>>);
+static_assert(!std::copyable<jge::morton_plane<std::unique_ptr<int>>>);
+
+template <class Layout>
+constexpr void test_layout()
+{
+    using layout_plane = jge::layout_plane<int, Layout>;
+    {
+        const layout_plane p;
+        assert(p.size() == 0_w + 0_h);
+        assert(p.storage().empty());
+    }
+    {
+        const layout_plane p{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        assert(p.size() == 3_w + 3_h);
+        assert((p[0_x + 0_y] == 0));
+        assert((p[2_x + 0_y] == 2));
+        assert((p[1_x + 2_y] == 7));
+        assert((p[2_x + 2_y] == 8));
+        assert(p.storage().size() == to1d(p.mapping().storage_size()));
+        for (std::size_t i{0}; i != p.storage().size(); ++i)
+        {
+            const auto pt{p.mapping().to2d(i)};
+            assert(!contains(p.size(), pt) || p.storage()[i] == p[pt]);
+        }
+
+        const jge::plane<int> row_major{p};
+        assert((row_major == jge::plane<int>{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}}));
+        assert((layout_plane{to1d(row_major), row_major.size().w} == p));
+
+        layout_plane copy{p};
+        assert(copy == p);
+        copy[1_x + 1_y] = -1;
+        assert(copy != p);
+        layout_plane moved{std::move(copy)};
+        assert(copy.size() == 0_w + 0_h);
+        assert((moved[1_x + 1_y] == -1));
+        copy = std::move(moved);
+        assert((copy[1_x + 1_y] == -1));
+        assert(moved.storage().size() == to1d(moved.mapping().storage_size()));
+    }
+    {
+        const layout_plane p{2_w + 5_h, jge::value_initialize};
+        assert(p.size() == 2_w + 5_h);
+        assert(std::ranges::all_of(p.storage(), [](int e) { return e == 0; }));
+
+        // Padding is not compared.
+        layout_plane padded{p};
+        for (std::size_t i{0}; i != padded.storage().size(); ++i)
+            if (!contains(padded.size(), padded.mapping().to2d(i)))
+                padded.storage()[i] = 1;
+        assert(padded == p);
+    }
+}
+
+constexpr void test()
+{
+    test_layout<jge::layout_row_major>();
+    test_layout<jge::layout_tiled<2>>();
+    test_layout<jge::layout_morton>();
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/mapped_plane.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(!std::copy_constructible<jge::mapped_plane<int>>);
+static_assert(std::is_nothrow_move_assignable_v<jge::mapped_plane<int>>);
+static_assert(std::same_as<
+              decltype(std::declval<const jge::mapped_plane<int>&>()[{}]),
+              const int&>);
+static_assert(std::same_as<
+              decltype(to1d(std::declval<const jge::mapped_plane<int>&>())),
+              std::span<const int>>);
+static_assert(jge::mapped_element_tag<int> != jge::mapped_element_tag<float>);
+static_assert(
+    jge::mapped_element_tag<std::int32_t> !=
+    jge::mapped_element_tag<std::uint32_t>);
+
+template <class E, class T>
+bool throws(const std::filesystem::path& file)
+{
+    try
+    {
+        const jge::mapped_plane<T> m{file};
+        return false;
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+}
+
+int main()
+{
+    const auto file{
+        std::filesystem::temp_directory_path() / "jge_mapped_plane_test.bin"};
+    const jge::plane<std::int32_t> p{{0, 1, 2}, {3, 4, 5}};
+    jge::write_mapped_plane(file, p);
+
+    {
+        const jge::mapped_plane<const std::int32_t> m{file};
+        assert(m.size() == 3_w + 2_h);
+        assert(std::ranges::equal(to1d(m), to1d(p)));
+        assert((m[2_x + 1_y] == 5));
+    }
+    {
+        jge::mapped_plane<std::int32_t> m{file};
+        m[0_x + 0_y] = 7;
+        assert((m[0_x + 0_y] == 7));
+        jge::mapped_plane<std::int32_t> m2{std::move(m)};
+        assert((m2[0_x + 0_y] == 7));
+        assert(to1d(m).empty());
+        const jge::mapped_plane<const std::int32_t> unchanged{file};
+        assert((unchanged[0_x + 0_y] == 0));
+    }
+    {
+        const jge::plane<std::int32_t> empty;
+        jge::write_mapped_plane(file, empty);
+        const jge::mapped_plane<const std::int32_t> m{file};
+        assert(m.size() == 0_w + 0_h);
+        assert(to1d(m).empty());
+    }
+
+    jge::write_mapped_plane(file, p);
+    assert((throws<std::runtime_error, const float>(file)));
+    assert((throws<std::runtime_error, const std::int64_t>(file)));
+    std::filesystem::resize_file(file, 64 + 5 * sizeof(std::int32_t));
+    assert((throws<std::runtime_error, const std::int32_t>(file)));
+    {
+        // 2^32 x 2^32 elements, whose count overflows.
+        auto h{jge::detail::make_mapped_plane_header<std::int32_t>({})};
+        h.width = h.height = std::uint64_t{1} << 32;
+        char header[jge::detail::mapped_plane_header::size]{};
+        std::memcpy(header, &h, sizeof(h));
+        std::ofstream{file, std::ios::binary | std::ios::trunc}.write(
+            header, sizeof(header));
+        assert((throws<std::runtime_error, const std::int32_t>(file)));
+    }
+    std::ofstream{file} << "JGE";
+    assert((throws<std::runtime_error, const std::int32_t>(file)));
+    std::filesystem::remove(file);
+    assert((throws<std::system_error, const std::int32_t>(file)));
+}
@@ -0,0 +1,122 @@
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <jge/cartesian.hpp>
+#include <jge/layout.hpp>
+#include <jge/layout_plane.hpp>
+#include <jge/mdspan.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+
+#ifndef JGE_HAS_MDSPAN
+#    error "Neither <mdspan> nor <experimental/mdspan> was found."
+#endif
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+// The element `[y, x]` of `m`, without the C++23 multidimensional subscript.
+template <class M>
+constexpr auto& at(const M& m, const std::size_t y, const std::size_t x)
+{
+    return m.data_handle()[m.mapping()(y, x)];
+}
+
+constexpr void test()
+{
+    jge::plane<int> p{{0, 1, 2}, {3, 4, 5}};
+
+    {
+        const auto m{jge::to_mdspan(p)};
+        static_assert(std::same_as<decltype(m), const jge::plane_mdspan<int>>);
+        assert(m.extent(0) == 2 && m.extent(1) == 3);
+        assert(m.data_handle() == to1d(p).data());
+        assert(at(m, 1, 2) == 5);
+        at(m, 0, 1) = 42;
+        assert((p[1_x + 0_y] == 42));
+
+        const jge::plane_view v{jge::to_plane_view(m)};
+        assert(v.size() == p.size());
+        assert(v.data() == to1d(p).data());
+        assert(v.is_contiguous());
+    }
+
+    {
+        const jge::plane<int>& cp{p};
+        const auto m{jge::to_mdspan(cp)};
+        static_assert(
+            std::same_as<decltype(m), const jge::plane_mdspan<const int>>);
+        assert(at(m, 1, 0) == 3);
+    }
+
+    {
+        const jge::plane_view v{p, {1_x + 0_y, 2_w + 2_h}};
+        const auto m{jge::to_mdspan(v)};
+        assert(m.extent(0) == 2 && m.extent(1) == 2);
+        assert(m.stride(0) == 3 && m.stride(1) == 1);
+        assert(at(m, 1, 1) == 5);
+
+        const jge::plane_view<int> back{jge::to_plane_view(m)};
+        assert(back.data() == v.data());
+        assert(back.size() == v.size());
+        assert(back.row_stride() == 3);
+    }
+
+    {
+        const jge::plane_view<int> row{to1d(p).data(), 3_w + 1_h, 1};
+        const auto m{jge::to_mdspan(row)};
+        assert(m.stride(0) == 3 && m.stride(1) == 1);
+        assert(at(m, 0, 2) == 2);
+
+        const auto empty{jge::to_mdspan(jge::plane_view<int>{})};
+        assert(empty.extent(0) == 0 && empty.extent(1) == 0);
+        assert(empty.stride(0) == 1);
+    }
+
+    {
+        jge::tiled_plane<int, 2> t{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        const auto m{jge::to_mdspan(t)};
+        assert(m.extent(0) == 3 && m.extent(1) == 3);
+        assert(m.mapping().required_span_size() == 16);
+        assert(!m.mapping().is_exhaustive());
+        for (std::size_t y{0}; y != 3; ++y)
+            for (std::size_t x{0}; x != 3; ++x)
+                assert((
+                    at(m, y, x) == t[jge::abscissa{x} + jge::ordinate{y}]));
+        at(m, 2, 2) = -1;
+        assert((t[2_x + 2_y] == -1));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,124 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <jge/cartesian.hpp>
+#include <jge/memory_resource.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+// Counts the allocations that reach the upstream resource.
+class counting_resource : public std::pmr::memory_resource
+{
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment)
+        override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+        void* const p, const std::size_t bytes,
+        const std::size_t alignment) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    int allocations{0};
+    int deallocations{0};
+};
+
+void test_frame_arena()
+{
+    counting_resource upstream;
+    {
+        jge::frame_arena arena{1024, &upstream};
+        assert(arena.upstream_resource() == &upstream);
+        assert(arena.stats() == jge::resource_stats{});
+
+        for (int frame{0}; frame != 3; ++frame)
+        {
+            const jge::pmr::plane<std::uint8_t> a{
+                16_w + 16_h, jge::value_initialize, &arena};
+            const jge::pmr::plane<std::uint64_t> b{
+                32_w + 32_h, jge::value_initialize, &arena};
+            assert(a.size() == 16_w + 16_h);
+            assert(reinterpret_cast<std::uintptr_t>(to1d(b).data()) %
+                       alignof(std::uint64_t) ==
+                   0);
+            arena.reset();
+        }
+        assert(upstream.allocations == 2);
+        assert(arena.stats().misses == 2);
+        assert(arena.stats().hits == 4);
+        assert(arena.stats().bytes_retained >= 256 + 32 * 32 * 8);
+
+        void* const p{arena.allocate(100, 64)};
+        assert(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+        arena.release();
+        assert(upstream.deallocations == 2);
+        assert(arena.stats().bytes_retained == 0);
+    }
+    assert(upstream.deallocations == 2);
+}
+
+void test_plane_pool()
+{
+    counting_resource upstream;
+    {
+        jge::plane_pool pool{1 << 20, &upstream};
+        assert(pool.upstream_resource() == &upstream);
+        for (int frame{0}; frame != 3; ++frame)
+        {
+            const jge::pmr::plane<int> a{
+                64_w + 64_h, jge::value_initialize, &pool};
+            const jge::pmr::plane<int> b{
+                64_w + 64_h, jge::value_initialize, &pool};
+            const jge::pmr::plane<int> c{
+                8_w + 8_h, jge::value_initialize, &pool};
+        }
+        assert(upstream.allocations == 3);
+        assert(pool.stats().misses == 3);
+        assert(pool.stats().hits == 6);
+        assert(
+            pool.stats().bytes_retained ==
+            (2 * 64 * 64 + 8 * 8) * sizeof(int));
+
+        pool.release();
+        assert(upstream.deallocations == 3);
+        assert(pool.stats().bytes_retained == 0);
+    }
+    {
+        jge::plane_pool pool{100 * sizeof(int), &upstream};
+        {
+            const jge::pmr::plane<int> big{
+                20_w + 20_h, jge::value_initialize, &pool};
+            const jge::pmr::plane<int> small{
+                5_w + 5_h, jge::value_initialize, &pool};
+        }
+        assert(pool.stats().bytes_retained == 25 * sizeof(int));
+    }
+}
+
+int main()
+{
+    test_frame_arena();
+    test_plane_pool();
+}
@@ -0,0 +1,94 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <jge/cartesian.hpp>
+#include <jge/mip_pyramid.hpp>
+#include <jge/plane.hpp>
+#include <jge/resample.hpp>
+#include <jge/thread_pool.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+jge::size2d<std::size_t> size(const std::size_t w, const std::size_t h)
+{
+    return jge::width{w} + jge::height{h};
+}
+
+void test_small()
+{
+    const jge::plane<int> p{{1, 3, 5, 7}, {3, 5, 7, 9}};
+    const jge::mip_pyramid pyramid{p};
+    assert(pyramid.size() == 3);
+    assert(pyramid[0] == p);
+    assert((pyramid[1] == jge::plane<int>{{3, 7}}));
+    assert((pyramid[2] == jge::plane<int>{{5}}));
+    assert(pyramid.all().size() == 3);
+    assert(&pyramid.level_for(3_w + 3_h) == &pyramid[1]);
+    assert(&pyramid.level_for(4_w + 2_h) == &pyramid[0]);
+    assert(&pyramid.level_for(0_w + 0_h) == &pyramid[2]);
+
+    using rgba = std::array<std::uint8_t, 4>;
+    const jge::mip_pyramid<rgba> pixels{jge::plane<rgba>{
+        {rgba{0, 0, 0, 255}, rgba{255, 0, 0, 255}},
+        {rgba{1, 0, 0, 255}, rgba{255, 1, 0, 255}}}};
+    assert(pixels.size() == 2);
+    assert((pixels[1] == jge::plane<rgba>{{rgba{128, 0, 0, 255}}}));
+
+    // Sums of channels near their limits do not overflow.
+    const jge::mip_pyramid<std::uint32_t> large{jge::plane<std::uint32_t>{
+        {4'000'000'000, 4'000'000'000}, {4'000'000'000, 4'000'000'001}}};
+    assert((large[1] == jge::plane<std::uint32_t>{{4'000'000'000}}));
+    const jge::mip_pyramid<std::int32_t> signed_large{jge::plane<std::int32_t>{
+        {2'000'000'000, 2'000'000'000}, {2'000'000'000, 2'000'000'002}}};
+    assert((signed_large[1] == jge::plane<std::int32_t>{{2'000'000'001}}));
+    const jge::mip_pyramid<std::int32_t> signed_small{jge::plane<std::int32_t>{
+        {-2'000'000'000, -2'000'000'000}, {-2'000'000'000, -2'000'000'002}}};
+    assert((signed_small[1] == jge::plane<std::int32_t>{{-2'000'000'001}}));
+
+    const jge::mip_pyramid<float> empty{jge::plane<float>{}};
+    assert(empty.size() == 1);
+    assert(jge::mip_pyramid<float>{}.size() == 0);
+}
+
+// Each level is the box filtered previous level, including odd sizes.
+void test_levels(jge::thread_pool& pool)
+{
+    for (const auto sz : {size(64, 64), size(37, 12), size(1, 9), size(16, 5)})
+    {
+        jge::plane<std::uint16_t> p{sz, jge::value_initialize};
+        for (std::size_t i{0}; i != to1d(sz); ++i)
+            to1d(p)[i] = static_cast<std::uint16_t>(i * 9973 % 65521);
+        const jge::mip_pyramid<std::uint16_t> pyramid{p, pool};
+        assert(pyramid[0] == p);
+        for (std::size_t i{1}; i != pyramid.size(); ++i)
+        {
+            const auto& from{pyramid[i - 1]};
+            const auto half{
+                jge::width{std::max(from.size().w() / 2, std::size_t{1})} +
+                jge::height{std::max(from.size().h() / 2, std::size_t{1})}};
+            assert(
+                pyramid[i] ==
+                jge::resample(from, half, jge::resample_filter::box, pool));
+        }
+        assert(to1d(pyramid[pyramid.size() - 1].size()) == 1);
+    }
+}
+
+int main()
+{
+    test_small();
+    for (const std::size_t threads : {1, 3})
+    {
+        jge::thread_pool pool{threads};
+        test_levels(pool);
+    }
+}
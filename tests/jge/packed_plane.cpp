@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <jge/cartesian.hpp>
+#include <jge/packed_plane.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(std::regular<jge::packed_plane<4>>);
+static_assert(jge::packed_plane<1>::palette_capacity == 2);
+static_assert(jge::packed_plane<8>::palette_capacity == 256);
+
+template <std::size_t Bits>
+void test_round_trip()
+{
+    // Rows whose width is not a multiple of the indices per word.
+    const jge::width w{std::size_t{64 / Bits * 2 + 3}};
+    const jge::height h{std::size_t{5}};
+    jge::plane<std::size_t> dense{w + h, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(dense).size(); ++i)
+        to1d(dense)[i] = (i * 7 + i / 5) % (std::size_t{1} << Bits) * 100;
+
+    const jge::packed_plane<Bits> p{dense};
+    assert(p.size() == dense.size());
+    assert(p.palette().size() <= std::size_t{1} << Bits);
+    assert(p.storage_bytes() == 3 * 8 * h());
+    assert(jge::plane<std::size_t>{p} == dense);
+    for (std::size_t y{0}; y != h(); ++y)
+        for (std::size_t x{0}; x != w(); ++x)
+        {
+            const auto pt{jge::abscissa{x} + jge::ordinate{y}};
+            assert(p[pt] == dense[pt]);
+            assert(p.palette()[p.index(pt)] == dense[pt]);
+        }
+
+    std::vector<std::uint8_t> indices(w());
+    p.unpack_row_indices(1, indices);
+    jge::packed_plane<Bits> q{w + h, {p.palette().begin(), p.palette().end()}};
+    for (std::size_t y{0}; y != h(); ++y)
+    {
+        p.unpack_row_indices(y, indices);
+        q.pack_row_indices(y, indices);
+    }
+    assert(q == p);
+}
+
+int main()
+{
+    test_round_trip<1>();
+    test_round_trip<2>();
+    test_round_trip<4>();
+    test_round_trip<8>();
+
+    {
+        const jge::packed_plane<4> p;
+        assert(p.size() == 0_w + 0_h);
+        assert(p.storage_bytes() == 0);
+    }
+    {
+        jge::packed_plane<2, std::string> p{3_w + 2_h, {"sky"}};
+        assert((p[2_x + 1_y] == "sky"));
+        p[2_x + 1_y] = "grass";
+        p[0_x + 0_y] = "dirt";
+        p[1_x + 0_y] = p[0_x + 0_y];
+        assert(std::ranges::equal(
+            p.palette(), std::array<std::string, 3>{"sky", "grass", "dirt"}));
+        assert((std::as_const(p)[1_x + 0_y] == "dirt"));
+        p[1_x + 1_y] = "stone";
+        bool threw{false};
+        try
+        {
+            p[0_x + 1_y] = "water";
+        }
+        catch (const std::length_error&)
+        {
+            threw = true;
+        }
+        assert(threw);
+        assert((p == jge::packed_plane<2, std::string>{
+                         {"dirt", "dirt", "sky"},
+                         {"sky", "stone", "grass"}}));
+
+        std::array<std::string, 3> row;
+        p.unpack_row(1, row);
+        assert((row == std::array<std::string, 3>{"sky", "stone", "grass"}));
+        p.pack_row(0, row);
+        assert((p[1_x + 0_y] == "stone"));
+    }
+}
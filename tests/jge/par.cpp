@@ -0,0 +1,154 @@
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <jge/cartesian.hpp>
+#include <jge/par.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/thread_pool.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+jge::point2d<std::size_t> at(const std::size_t x, const std::size_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+jge::plane<int> numbered(const jge::size2d<std::size_t> sz)
+{
+    jge::plane<int> p{sz, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(sz); ++i)
+        to1d(p)[i] = static_cast<int>(i % 1'000);
+    return p;
+}
+
+void test_small(jge::thread_pool& pool)
+{
+    jge::plane<int> p{{1, 2, 3}, {4, 5, 6}};
+
+    jge::par::for_each_point(
+        p,
+        [](const jge::point2d<std::size_t> pt, int& e) {
+            e += static_cast<int>(pt.x() * 10 + pt.y() * 100);
+        },
+        pool);
+    assert((p == jge::plane<int>{{1, 12, 23}, {104, 115, 126}}));
+
+    jge::plane<long> q{3_w + 2_h, jge::value_initialize};
+    jge::par::transform(
+        p, q,
+        [](jge::point2d<std::size_t>, const int e) { return long{e} * 2; },
+        pool);
+    assert((q == jge::plane<long>{{2, 24, 46}, {208, 230, 252}}));
+
+    assert(jge::par::reduce(p, 0, std::plus<>{}, pool) == 381);
+    assert(
+        jge::par::count_if(
+            p, [](jge::point2d<std::size_t>, const int e) { return e > 20; },
+            pool) == 4);
+    assert(
+        (jge::par::find_if(
+             p,
+             [](jge::point2d<std::size_t>, const int e) { return e > 100; },
+             pool) == at(0, 1)));
+    assert(!jge::par::find_if(
+        p, [](jge::point2d<std::size_t>, const int e) { return e < 0; },
+        pool));
+
+    // On a subplane, with points relative to it.
+    const jge::plane_view v{p, {1_x + 0_y, 2_w + 2_h}};
+    assert(jge::par::reduce(v, 0, std::plus<>{}, pool) == 276);
+    assert(
+        (jge::par::find_if(
+             v,
+             [](const jge::point2d<std::size_t> pt, int) {
+                 return pt.x() == 1 && pt.y() == 1;
+             },
+             pool) == at(1, 1)));
+    jge::par::for_each_point(
+        v, [](jge::point2d<std::size_t>, int& e) { e = 0; }, pool);
+    assert((p == jge::plane<int>{{1, 0, 0}, {104, 0, 0}}));
+
+    const jge::plane<int> empty;
+    assert(jge::par::reduce(empty, 7, std::plus<>{}, pool) == 7);
+    assert(jge::par::count_if(
+               empty, [](jge::point2d<std::size_t>, int) { return true; },
+               pool) == 0);
+}
+
+// Planes of many bands, against the serial definitions.
+void test_large(jge::thread_pool& pool)
+{
+    const jge::plane<int> p{numbered(
+        jge::width{std::size_t{1'003}} + jge::height{std::size_t{517}})};
+    const jge::plane_view v{p, {at(5, 3), jge::width{std::size_t{990}} +
+                                              jge::height{std::size_t{511}}}};
+
+    long long sum{0};
+    std::size_t evens{0};
+    for (std::size_t y{0}; y != v.size().h(); ++y)
+        for (const int e : v.row(y))
+        {
+            sum += e;
+            evens += e % 2 == 0;
+        }
+    assert(jge::par::reduce(v, 0LL, std::plus<>{}, pool) == sum);
+    assert(
+        jge::par::count_if(
+            v,
+            [](jge::point2d<std::size_t>, const int e) { return e % 2 == 0; },
+            pool) == evens);
+
+    jge::plane<int> out{v.size(), jge::value_initialize};
+    jge::par::transform(
+        v, out,
+        [](const jge::point2d<std::size_t> pt, const int e) {
+            return e - static_cast<int>(pt.x());
+        },
+        pool);
+    for (std::size_t y{0}; y != v.size().h(); ++y)
+        for (std::size_t x{0}; x != v.size().w(); ++x)
+            assert(out[at(x, y)] == v[at(x, y)] - static_cast<int>(x));
+
+    // Matches in several bands; the first in row-major order wins.
+    for (const std::size_t row : {0, 1, 200, 400, 510})
+    {
+        const auto found{jge::par::find_if(
+            v,
+            [&](const jge::point2d<std::size_t> pt, int) {
+                return pt.y() >= row && pt.x() == 7 + pt.y() % 3;
+            },
+            pool)};
+        assert((found == at(7 + row % 3, row)));
+    }
+}
+
+int main()
+{
+    for (const std::size_t threads : {1, 3, 8})
+    {
+        jge::thread_pool pool{threads};
+        test_small(pool);
+        test_large(pool);
+    }
+    test_large(jge::default_thread_pool());
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/pitched_plane.hpp>
+#include <jge/plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(+std::regular</*   */ jge::pitched_plane<int>>);
+static_assert(+std::movable</*   */ jge::pitched_plane<std::unique_ptr<int>>>);
+static_assert(!std::copyable</*  */ jge::pitched_plane<std::unique_ptr<int>>>);
+static_assert(std::is_nothrow_move_assignable_v<jge::pitched_plane<int>>);
+static_assert(jge::pitched_plane<int>::row_alignment == 64);
+static_assert(jge::pitched_plane<char, 16>::row_alignment == 16);
+
+template <class P>
+bool rows_are_aligned(const P& p)
+{
+    for (std::size_t y{0}; y != p.size().h(); ++y)
+        if (reinterpret_cast<std::uintptr_t>(p.row(y).data()) %
+                P::row_alignment !=
+            0)
+            return false;
+    return true;
+}
+
+int main()
+{
+    {
+        const jge::pitched_plane<int> p;
+        assert(p.size() == 0_w + 0_h);
+        assert(p.row_pitch() == 0);
+        assert(p == jge::pitched_plane<int>{});
+    }
+    {
+        const jge::pitched_plane<int> p{{0, 1, 2}, {3, 4, 5}};
+        assert(p.size() == 3_w + 2_h);
+        assert(p.row_pitch() == 16);
+        assert(rows_are_aligned(p));
+        assert(p[0_x + 0_y] == 0);
+        assert(p[2_x + 0_y] == 2);
+        assert(p[0_x + 1_y] == 3);
+        assert(p[2_x + 1_y] == 5);
+        assert(&p[0_x + 1_y] == &p[0_x + 0_y] + p.row_pitch());
+        assert(std::ranges::equal(p.row(1), std::array{3, 4, 5}));
+    }
+    {
+        const jge::pitched_plane<std::uint8_t> p{
+            20_w + 3_h, jge::value_initialize};
+        assert(p.row_pitch() == 64);
+        assert(rows_are_aligned(p));
+        assert(std::ranges::all_of(p.row(2), [](auto e) { return e == 0; }));
+    }
+    {
+        const jge::pitched_plane<std::uint8_t, 16> p{
+            17_w + 2_h, jge::default_initialize};
+        assert(p.row_pitch() == 32);
+        assert(rows_are_aligned(p));
+    }
+    {
+        // Elements that do not tile the alignment.
+        using rgb = std::array<std::uint8_t, 3>;
+        const jge::pitched_plane<rgb> p{
+            {rgb{1, 2, 3}, rgb{4, 5, 6}}, {rgb{7, 8, 9}, rgb{10, 11, 12}}};
+        assert(p.row_pitch() == 64);
+        assert(rows_are_aligned(p));
+        assert((p[1_x + 1_y] == rgb{10, 11, 12}));
+
+        using float3 = std::array<float, 3>;
+        const jge::pitched_plane<float3, 16> q{
+            5_w + 3_h, jge::value_initialize};
+        assert(q.row_pitch() == 8);
+        assert(rows_are_aligned(q));
+        assert((q[4_x + 2_y] == float3{}));
+    }
+    {
+        const jge::plane<int> p{{0, 1}, {2, 3}, {4, 5}};
+        const jge::pitched_plane<int> pp{to1d(p), p.size().w};
+        assert(pp.size() == p.size());
+        assert(pp == jge::pitched_plane<int>({{0, 1}, {2, 3}, {4, 5}}));
+        assert(pp != jge::pitched_plane<int>({{0, 1, 2}, {3, 4, 5}}));
+    }
+    {
+        const jge::pitched_plane<int> p1{{0, 1}, {2, 3}};
+        jge::pitched_plane<int> p2{p1};
+        assert(p1 == p2);
+        assert(p1.row(0).data() != p2.row(0).data());
+        p2[1_x + 1_y] = 4;
+        assert(p1 != p2);
+        const auto* const data{p2.row(0).data()};
+        p2 = p1;
+        assert(p1 == p2);
+        assert(p2.row(0).data() == data);
+        jge::pitched_plane<int> p3{std::move(p2)};
+        assert(p3 == p1);
+        assert(p2 == jge::pitched_plane<int>{});
+        p2 = std::move(p3);
+        assert(p2 == p1);
+    }
+    {
+        std::pmr::monotonic_buffer_resource mr1;
+        std::pmr::monotonic_buffer_resource mr2;
+        const jge::pmr::pitched_plane<int> p1{{{0, 1}, {2, 3}}, &mr1};
+        assert(rows_are_aligned(p1));
+        jge::pmr::pitched_plane<int> p2{&mr2};
+        p2 = p1;
+        assert(p2.get_allocator().resource() == &mr2);
+        assert(p1 == p2);
+        jge::pmr::pitched_plane<int> p3{std::move(p2), &mr1};
+        assert(p3.get_allocator().resource() == &mr1);
+        assert(p1 == p3);
+    }
+}
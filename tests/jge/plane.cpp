@@ -4,6 +4,7 @@
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <memory_resource>
 #include <span>
 #include <type_traits>
 #include <utility>
@@ -109,6 +110,14 @@ static_assert(std::same_as<jge::plane<int>, decltype(jge::plane{{0}})>);
 static_assert(std::same_as<jge::plane<int>, decltype(jge::plane{{0}, 0_w})>);
 static_assert(std::same_as<jge::plane<char>, decltype(jge::plane{"", 0_w})>);
 
+static_assert(std::same_as<
+              std::pmr::polymorphic_allocator<int>,
+              jge::pmr::plane<int>::allocator_type>);
+static_assert(+std::regular<jge::pmr::plane<int>>);
+static_assert(!std::is_nothrow_move_assignable_v<jge::pmr::plane<int>>);
+static_assert(std::uses_allocator_v<
+              jge::pmr::plane<int>, std::pmr::polymorphic_allocator<int>>);
+
 constexpr void test()
 {
     {
@@ -350,6 +359,19 @@ constexpr void test()
         !constant([] { (void)jge::plane<int>(0_w + 1_h, value_initialize); });
     }
 
+    {
+        jge::plane<int> p{2_w + 1_h, jge::for_overwrite};
+        assert(p.size() == 2_w + 1_h);
+        std::ranges::fill(to1d(p), 1);
+        assert(p == jge::plane({{1, 1}}));
+    }
+    {
+        constexpr jge::parallel_value_initialize_t pvi;
+        assert(jge::plane<int>(0_w + 0_h, pvi) == jge::plane<int>());
+        assert(jge::plane<int>(1_w + 1_h, pvi) == jge::plane({{0}}));
+        assert(jge::plane<int>(2_w + 2_h, pvi) == jge::plane({{0, 0}, {0, 0}}));
+    }
+
     {
         constexpr jge::value_initialize_t vi;
         assert(jge::plane<int>(1_w + 1_h, vi) == jge::plane({{0}}));
@@ -451,6 +473,147 @@ constexpr void test()
         assert(p1 == p2);
         assert(p3 == jge::plane({{4, 5}}));
     }
+
+    {
+        jge::plane<int> p;
+        assert(p.capacity() == 0);
+        p.reserve(4);
+        assert(p.capacity() == 4);
+        assert(p.size() == 0_w + 0_h);
+        const std::span s0{to1d(p)};
+        p = {{0, 1}, {2, 3}};
+        assert(p.capacity() == 4);
+        assert(to1d(p).data() == s0.data());
+        p = {{4}};
+        assert(p == jge::plane({{4}}));
+        assert(p.capacity() == 4);
+        assert(to1d(p).data() == s0.data());
+        p.shrink_to_fit();
+        assert(p.capacity() == 1);
+        assert(p == jge::plane({{4}}));
+        p.reserve(1);
+        assert(p.capacity() == 1);
+    }
+    {
+        const auto resized = [](const jge::plane<int>& p,
+                                const jge::plane<int>::size_type sz,
+                                const jge::anchor a) {
+            jge::plane<int> in_place{p};
+            in_place.reserve(to1d(sz));
+            const std::span s{to1d(in_place)};
+            in_place.resize(sz, a);
+            assert(to1d(in_place).data() == s.data() || to1d(sz) == 0);
+            jge::plane<int> reallocated{p};
+            reallocated.shrink_to_fit();
+            reallocated.resize(sz, a);
+            assert(in_place == reallocated);
+            return in_place;
+        };
+        using enum jge::anchor;
+        const jge::plane p{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        assert(resized(p, 3_w + 3_h, center) == p);
+        assert(resized(p, 2_w + 2_h, top_left) == jge::plane({{0, 1}, {3, 4}}));
+        assert(
+            resized(p, 2_w + 2_h, bottom_right) ==
+            jge::plane({{4, 5}, {7, 8}}));
+        assert(resized(p, 1_w + 1_h, center) == jge::plane({{4}}));
+        assert(
+            resized(p, 1_w + 5_h, center) ==
+            jge::plane({{0}, {1}, {4}, {7}, {0}}));
+        assert(
+            resized(p, 5_w + 1_h, top_right) ==
+            jge::plane({{0, 0, 0, 1, 2}}));
+        assert(resized(p, 0_w + 0_h, center) == jge::plane<int>{});
+        assert(
+            resized(p, 5_w + 5_h, center) == jge::plane({{0, 0, 0, 0, 0},
+                                                         {0, 0, 1, 2, 0},
+                                                         {0, 3, 4, 5, 0},
+                                                         {0, 6, 7, 8, 0},
+                                                         {0, 0, 0, 0, 0}}));
+        assert(
+            resized(p, 4_w + 2_h, bottom) ==
+            jge::plane({{3, 4, 5, 0}, {6, 7, 8, 0}}));
+        assert(
+            resized(p, 2_w + 4_h, right) ==
+            jge::plane({{1, 2}, {4, 5}, {7, 8}, {0, 0}}));
+        assert(
+            resized(p, 4_w + 4_h, bottom_left) ==
+            jge::plane(
+                {{0, 0, 0, 0}, {0, 1, 2, 0}, {3, 4, 5, 0}, {6, 7, 8, 0}}));
+        const jge::plane q{{0, 1}, {2, 3}, {4, 5}};
+        assert(
+            resized(q, 3_w + 2_h, bottom_left) ==
+            jge::plane({{2, 3, 0}, {4, 5, 0}}));
+        assert(
+            resized(q, 3_w + 2_h, top_right) ==
+            jge::plane({{0, 0, 1}, {0, 2, 3}}));
+        assert(
+            resized(jge::plane<int>{}, 2_w + 1_h, center) ==
+            jge::plane({{0, 0}}));
+    }
+    {
+        jge::plane p{{0, 1}};
+        p.resize(3_w + 1_h);
+        assert(p.capacity() == 4);
+        p.resize(4_w + 1_h);
+        assert(p.capacity() == 4);
+        p.resize(5_w + 1_h);
+        assert(p.capacity() == 8);
+        assert(p == jge::plane({{0, 1, 0, 0, 0}}));
+    }
+}
+
+void test_parallel()
+{
+    for (const std::size_t side : {1, 7, 300, 1000})
+    {
+        const jge::width w{side};
+        const jge::height h{side + 1};
+        jge::plane<int> expected{w + h, jge::for_overwrite};
+        std::ranges::fill(to1d(expected), 0);
+        assert(
+            expected ==
+            jge::plane<int>(w + h, jge::parallel_value_initialize));
+    }
+}
+
+void test_pmr()
+{
+    std::pmr::monotonic_buffer_resource mr1;
+    std::pmr::monotonic_buffer_resource mr2;
+
+    {
+        const jge::pmr::plane<int> p{{{0, 1}, {2, 3}}, &mr1};
+        assert(p.get_allocator().resource() == &mr1);
+        assert(std::ranges::equal(std::array{0, 1, 2, 3}, to1d(p)));
+        const jge::pmr::plane<int> p2{p};
+        assert(p2.get_allocator().resource() != &mr1);
+        assert(p == p2);
+        const jge::pmr::plane<int> p3{p, &mr2};
+        assert(p3.get_allocator().resource() == &mr2);
+        assert(p == p3);
+    }
+    {
+        jge::pmr::plane<int> p1{1_w + 2_h, jge::value_initialize, &mr1};
+        jge::pmr::plane<int> p2{{{0, 1}, {2, 3}}, &mr2};
+        const std::span s{to1d(p2)};
+        p1 = p2;
+        assert(p1.get_allocator().resource() == &mr1);
+        assert(p1 == p2);
+        assert(to1d(p1).data() != s.data());
+        p1 = std::move(p2);
+        assert(p1.get_allocator().resource() == &mr1);
+        assert(to1d(p1).data() != s.data());
+        const jge::pmr::plane<int> p3{std::move(p1), &mr1};
+        assert(p3.get_allocator().resource() == &mr1);
+        assert(p3 == jge::pmr::plane<int>({{0, 1}, {2, 3}}));
+    }
+    {
+        jge::pmr::plane<int> p1{{{0, 1}}, &mr1};
+        const std::span s{to1d(p1)};
+        const jge::pmr::plane<int> p2{std::move(p1), &mr1};
+        assert(to1d(p2).data() == s.data());
+    }
 }
 
 consteval auto const_invoke(auto f)
@@ -467,4 +630,6 @@ int main()
 {
     const_invoke(test);
     run_invoke(test);
+    test_parallel();
+    test_pmr();
 }
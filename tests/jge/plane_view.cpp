@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(std::semiregular<jge::plane_view<int>>);
+static_assert(std::is_trivially_copyable_v<jge::plane_view<int>>);
+static_assert(
+    std::convertible_to<jge::plane_view<int>, jge::plane_view<const int>>);
+static_assert(
+    !std::convertible_to<jge::plane_view<const int>, jge::plane_view<int>>);
+static_assert(std::constructible_from<
+              jge::plane_view<const int>, const jge::plane<int>&>);
+static_assert(
+    !std::constructible_from<jge::plane_view<int>, const jge::plane<int>&>);
+static_assert(std::same_as<
+              decltype(jge::plane_view{std::declval<jge::plane<int>&>()}),
+              jge::plane_view<int>>);
+static_assert(std::same_as<
+              decltype(jge::plane_view{
+                  std::declval<const jge::plane<int>&>()}),
+              jge::plane_view<const int>>);
+
+constexpr void test()
+{
+    jge::plane<int> p{{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}};
+
+    {
+        const jge::plane_view v{p};
+        assert(v.size() == 4_w + 3_h);
+        assert(v.row_stride() == 4);
+        assert(v.is_contiguous());
+        assert(v.data() == to1d(p).data());
+        assert((v[2_x + 1_y] == 6));
+        assert(std::ranges::equal(v.row(2), std::array{8, 9, 10, 11}));
+        v[0_x + 0_y] = 42;
+        assert((p[0_x + 0_y] == 42));
+        p[0_x + 0_y] = 0;
+    }
+
+    {
+        const jge::plane_view v{p, {1_x + 1_y, 2_w + 2_h}};
+        assert(v.size() == 2_w + 2_h);
+        assert(v.row_stride() == 4);
+        assert(!v.is_contiguous());
+        assert((v[0_x + 0_y] == 5));
+        assert((v[1_x + 1_y] == 10));
+        assert(std::ranges::equal(v.row(1), std::array{9, 10}));
+        for (const std::size_t y : {0, 1})
+            std::ranges::fill(v.row(y), -1);
+        assert((p == jge::plane<int>{
+                         {0, 1, 2, 3}, {4, -1, -1, 7}, {8, -1, -1, 11}}));
+
+        const jge::plane_view<const int> c{v};
+        assert(c.data() == v.data());
+        assert((c[1_x + 0_y] == -1));
+
+        const auto s{v.subview({1_x + 0_y, 1_w + 2_h})};
+        assert(s.size() == 1_w + 2_h);
+        assert(s.data() == &p[2_x + 1_y]);
+        assert(v.subview({2_x + 2_y, 0_w + 0_h}).size() == 0_w + 0_h);
+    }
+
+    {
+        const jge::plane<int>& cp{p};
+        const jge::plane_view v{cp, {0_x + 2_y, 4_w + 1_h}};
+        static_assert(
+            std::same_as<decltype(v), const jge::plane_view<const int>>);
+        assert(v.is_contiguous());
+        assert((v[3_x + 0_y] == 11));
+    }
+
+    {
+        const jge::plane_view<int> v;
+        assert(v.size() == 0_w + 0_h);
+        assert(v.data() == nullptr);
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+// A foreign RGBA buffer with padded rows, like an image library's.
+void test_foreign_buffer()
+{
+    std::array<std::uint8_t, 4 * 6 * 3> pixels{};
+    using rgba = std::array<std::uint8_t, 4>;
+    rgba* const first{reinterpret_cast<rgba*>(pixels.data())};
+    const jge::plane_view image{first, 5_w + 3_h, 6};
+    assert(image.row_stride() == 6);
+    image[4_x + 2_y] = rgba{1, 2, 3, 4};
+    assert(pixels[(2 * 6 + 4) * 4 + 3] == 4);
+
+    const jge::plane_view<const rgba> region{
+        image.subview({3_x + 1_y, 2_w + 2_h})};
+    assert((region[1_x + 1_y] == rgba{1, 2, 3, 4}));
+    assert(region.row(0).data() == first + 6 + 3);
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+    test_foreign_buffer();
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/resample.hpp>
+#include <jge/thread_pool.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+jge::point2d<std::size_t> at(const std::size_t x, const std::size_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+jge::size2d<std::size_t> size(const std::size_t w, const std::size_t h)
+{
+    return jge::width{w} + jge::height{h};
+}
+
+// Only `resample_nearest` resamples elements that are not filterable.
+template <class P>
+concept filterable = requires(const P& p) {
+    jge::resample(p, jge::size2d<std::size_t>{});
+};
+static_assert(filterable<jge::plane<float>>);
+static_assert(filterable<jge::plane<std::array<std::uint8_t, 4>>>);
+static_assert(!filterable<jge::plane<std::string>>);
+static_assert(!filterable<jge::plane<bool>>);
+
+void test_nearest()
+{
+    const jge::plane<std::string> p{{"a", "b"}, {"c", "d"}};
+    assert((jge::resample_nearest(p, 4_w + 2_h) ==
+            jge::plane<std::string>{
+                {"a", "a", "b", "b"}, {"c", "c", "d", "d"}}));
+
+    const jge::plane<int> q{{1, 2, 3, 4, 5, 6}, {7, 8, 9, 10, 11, 12}};
+    assert((jge::resample(q, 3_w + 1_h, jge::resample_filter::nearest) ==
+            jge::plane<int>{{8, 10, 12}}));
+}
+
+void test_bilinear()
+{
+    const jge::plane<float> p{{0, 4}, {8, 12}};
+    const auto r{jge::resample(p, 4_w + 4_h)};
+    assert((r == jge::plane<float>{
+                     {0, 1, 3, 4}, {2, 3, 5, 6}, {6, 7, 9, 10},
+                     {8, 9, 11, 12}}));
+
+    // The same size is the identity.
+    const jge::plane<int> q{{1, 2, 3}, {4, 5, 6}};
+    assert(jge::resample(q, q.size()) == q);
+}
+
+void test_box()
+{
+    const jge::plane<int> p{{1, 2, 3, 4, 5, 6}, {7, 8, 9, 10, 11, 12}};
+    assert((jge::resample(p, 3_w + 1_h, jge::resample_filter::box) ==
+            jge::plane<int>{{5, 7, 9}}));
+    assert((jge::resample(p, 2_w + 1_h, jge::resample_filter::box) ==
+            jge::plane<int>{{5, 8}}));
+    assert((jge::resample(p, 4_w + 1_h, jge::resample_filter::box) ==
+            jge::plane<int>{{4, 6, 7, 9}}));
+    assert((jge::resample(p, 1_w + 1_h, jge::resample_filter::box) ==
+            jge::plane<int>{{7}}));
+
+    // Pixels, rounded and clamped per channel.
+    using rgba = std::array<std::uint8_t, 4>;
+    const jge::plane<rgba> px{{rgba{0, 255, 10, 1}, rgba{255, 255, 11, 2}}};
+    assert((jge::resample(px, 1_w + 1_h, jge::resample_filter::box) ==
+            jge::plane<rgba>{{rgba{128, 255, 11, 2}}}));
+}
+
+// Against the definitions, on views, with several threads.
+void test_against_definitions(jge::thread_pool& pool)
+{
+    jge::plane<float> big{53_w + 47_h, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(big.size()); ++i)
+        to1d(big)[i] = static_cast<float>(i * 37 % 101);
+    const jge::plane_view src{big, {at(2, 3), size(50, 41)}};
+
+    for (const auto sz : {size(17, 13), size(50, 41), size(123, 90)})
+    {
+        jge::plane<float> res{sz, jge::value_initialize};
+        jge::resample(src, res, jge::resample_filter::box, pool);
+        const double sx{50.0 / double(sz.w())};
+        const double sy{41.0 / double(sz.h())};
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                // The integral of `src` over the area of the element.
+                double sum{0};
+                for (std::size_t j{0}; j != 41; ++j)
+                    for (std::size_t i{0}; i != 50; ++i)
+                    {
+                        const double cx{
+                            std::min(double(x + 1) * sx, double(i + 1)) -
+                            std::max(double(x) * sx, double(i))};
+                        const double cy{
+                            std::min(double(y + 1) * sy, double(j + 1)) -
+                            std::max(double(y) * sy, double(j))};
+                        if (cx > 0 && cy > 0)
+                            sum += cx * cy * src[at(i, j)];
+                    }
+                assert(std::abs(res[at(x, y)] - sum / (sx * sy)) < 1e-3);
+            }
+
+        jge::resample(src, res, jge::resample_filter::bilinear, pool);
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const auto clamped{[](const double s, const std::size_t n) {
+                    return std::clamp(s, 0.0, double(n - 1));
+                }};
+                const double u{clamped((double(x) + 0.5) * sx - 0.5, 50)};
+                const double v{clamped((double(y) + 0.5) * sy - 0.5, 41)};
+                const auto x0{std::size_t(u)};
+                const auto y0{std::size_t(v)};
+                const std::size_t x1{std::min(x0 + 1, std::size_t{49})};
+                const std::size_t y1{std::min(y0 + 1, std::size_t{40})};
+                const double fx{u - double(x0)};
+                const double fy{v - double(y0)};
+                const double expected{
+                    (src[at(x0, y0)] * (1 - fx) + src[at(x1, y0)] * fx) *
+                        (1 - fy) +
+                    (src[at(x0, y1)] * (1 - fx) + src[at(x1, y1)] * fx) * fy};
+                assert(std::abs(res[at(x, y)] - expected) < 1e-3);
+            }
+    }
+}
+
+int main()
+{
+    test_nearest();
+    test_bilinear();
+    test_box();
+    for (const std::size_t threads : {1, 3})
+    {
+        jge::thread_pool pool{threads};
+        test_against_definitions(pool);
+    }
+}
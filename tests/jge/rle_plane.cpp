@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <string>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/rle_plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+static_assert(std::regular<jge::rle_plane<int>>);
+
+int main()
+{
+    using run = jge::rle_plane<int>::run_type;
+    {
+        const jge::rle_plane<int> p;
+        assert(p.size() == 0_w + 0_h);
+        assert(p.run_count() == 0);
+        assert(jge::plane<int>{p} == jge::plane<int>{});
+    }
+    {
+        const jge::plane<int> dense{
+            {0, 0, 0, 0, 0},
+            {1, 1, 2, 2, 2},
+            {1, 1, 1, 1, 3},
+            {3, 4, 5, 6, 7}};
+        const jge::rle_plane<int> p{dense};
+        assert(p.size() == 5_w + 4_h);
+        assert(p.run_count() == 1 + 2 + 2 + 5);
+        assert(std::ranges::equal(p.row_runs_of(0), std::array{run{0, 5, 0}}));
+        assert(std::ranges::equal(
+            p.row_runs_of(1), std::array{run{0, 2, 1}, run{2, 3, 2}}));
+        assert(p.row_runs_of(3).size() == 5);
+        assert(p.all_runs().size() == p.run_count());
+        for (std::size_t y{0}; y != 4; ++y)
+            for (std::size_t x{0}; x != 5; ++x)
+                assert((p[jge::abscissa{x} + jge::ordinate{y}] ==
+                        dense[jge::abscissa{x} + jge::ordinate{y}]));
+        assert(jge::plane<int>{p} == dense);
+        assert((p == jge::rle_plane<int>{to1d(dense), dense.size().w}));
+        assert(
+            (p != jge::rle_plane<int>{
+                     {0, 0, 0, 0, 0},
+                     {1, 1, 2, 2, 2},
+                     {1, 1, 1, 1, 3},
+                     {3, 4, 5, 6, 6}}));
+    }
+    {
+        // Runs do not span rows.
+        const jge::rle_plane<std::string> p{{"a", "a"}, {"a", "b"}};
+        assert(p.run_count() == 3);
+        assert((p[0_x + 1_y] == "a"));
+        assert((p[1_x + 1_y] == "b"));
+    }
+}
@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/small_plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+template <class T>
+using small_plane_9 = jge::small_plane<T, 9>;
+
+static_assert(+std::regular</* */ small_plane_9<int>>);
+static_assert(+std::movable</* */ small_plane_9<std::unique_ptr<int>>>);
+static_assert(!std::copyable</**/ small_plane_9<std::unique_ptr<int>>>);
+static_assert(+std::is_nothrow_move_constructible_v<small_plane_9<int>>);
+static_assert(+std::is_nothrow_move_assignable_v</**/ small_plane_9<int>>);
+static_assert(!std::is_nothrow_copy_constructible_v<small_plane_9<int>>);
+
+// Counts the allocations of all its copies.
+template <class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    std::size_t* count;
+
+    counting_allocator(std::size_t& count) noexcept : count{&count}
+    {
+    }
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept
+      : count{other.count}
+    {
+    }
+
+    T* allocate(const std::size_t n)
+    {
+        ++*count;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    bool operator==(const counting_allocator&) const = default;
+};
+
+constexpr void test()
+{
+    {
+        const small_plane_9<int> p;
+        assert(to1d(p).empty());
+        assert(p.size() == 0_w + 0_h);
+    }
+    {
+        small_plane_9<int> p{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        const auto& cp{p};
+        assert(std::ranges::equal(
+            std::array{0, 1, 2, 3, 4, 5, 6, 7, 8}, to1d(cp)));
+        assert(cp.size() == 3_w + 3_h);
+        assert(cp[2_x + 1_y] == 5);
+        assert((p[2_x + 1_y] = 9) == 9);
+        assert(&p[1_x + 1_y] == &cp[1_x + 1_y]);
+    }
+    {
+        const small_plane_9<int> p1{2_w + 2_h, jge::value_initialize};
+        assert((p1 == small_plane_9<int>{{0, 0}, {0, 0}}));
+        small_plane_9<int> p2{p1};
+        assert(p1 == p2);
+        p2[0_x + 0_y] = 1;
+        assert(p1 != p2);
+        small_plane_9<int> p3{std::move(p2)};
+        assert(p3[0_x + 0_y] == 1);
+        assert(p2 == small_plane_9<int>{});
+        p2 = p1;
+        assert(p2 == p1);
+        p2 = std::move(p3);
+        assert(p2[0_x + 0_y] == 1);
+        assert(p3 == p1);
+    }
+    {
+        const small_plane_9<int> p1{{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}};
+        small_plane_9<int> p2{{0}};
+        p2 = p1;
+        assert(p1 == p2);
+        small_plane_9<int> p3{std::move(p2)};
+        assert(p1 == p3);
+        assert(p2 == small_plane_9<int>{});
+        assert(jge::plane<int>(p3) == jge::plane<int>(to1d(p1), 5_w));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+void test_storage()
+{
+    std::size_t allocations{0};
+    using plane = jge::small_plane<int, 9, counting_allocator<int>>;
+    const counting_allocator<int> alloc{allocations};
+    {
+        plane p1{3_w + 3_h, jge::value_initialize, alloc};
+        assert(p1.is_small());
+        const void* const elem{&p1[0_x + 0_y]};
+        assert(&p1 <= elem && elem < &p1 + 1);
+        plane p2{std::move(p1)};
+        plane p3{{{0, 1}}, alloc};
+        p3 = std::move(p2);
+        p2 = p3;
+        assert(p2 == p3);
+        assert(std::ranges::all_of(to1d(p3), [](int e) { return e == 0; }));
+    }
+    assert(allocations == 0);
+    {
+        plane p1{{{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}}, alloc};
+        assert(!p1.is_small());
+        assert(allocations == 1);
+        const auto* const data{to1d(p1).data()};
+        plane p2{std::move(p1)};
+        assert(to1d(p2).data() == data);
+        assert(allocations == 1);
+    }
+}
+
+// An element whose `throw_on_move`th move throws, and that counts the live
+// elements.
+struct throwing_move
+{
+    static inline int live{0};
+    static inline int throw_on_move{0};
+
+    int value{};
+
+    throwing_move(const int v) noexcept : value{v}
+    {
+        ++live;
+    }
+
+    throwing_move(const throwing_move& other) noexcept : value{other.value}
+    {
+        ++live;
+    }
+
+    throwing_move(throwing_move&& other) : value{other.value}
+    {
+        if (--throw_on_move == 0)
+            throw 0;
+        ++live;
+    }
+
+    throwing_move& operator=(const throwing_move&) = default;
+
+    ~throwing_move()
+    {
+        --live;
+    }
+
+    bool operator==(const throwing_move&) const = default;
+};
+
+template <class F>
+bool throws(F f)
+{
+    try
+    {
+        f();
+        return false;
+    }
+    catch (int)
+    {
+        return true;
+    }
+}
+
+void test_throwing_move()
+{
+    using plane = jge::small_plane<throwing_move, 4>;
+    {
+        const plane a0{{1, 2}};
+        const plane b0{{3, 4}};
+        for (const int n : {1, 2, 3, 4})
+        {
+            plane a{a0};
+            plane b{b0};
+            // Moves `a` aside, `b` into `a`, and then `a` into `b`.
+            throwing_move::throw_on_move = n;
+            assert(throws([&] { a = std::move(b); }));
+            assert(a == a0);
+            assert(b == b0);
+        }
+    }
+    {
+        const std::array<throwing_move, 3> xs{1, 2, 3};
+        plane a{{1, 2}};
+        throwing_move::throw_on_move = 1;
+        assert(throws([&] { a.assign(std::span{xs}, 3_w); }));
+        assert(a.size() == 0_w + 0_h);
+        assert(to1d(a).empty());
+    }
+    assert(throwing_move::live == 0);
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+    test_storage();
+    test_throwing_move();
+}
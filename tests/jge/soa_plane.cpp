@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/soa_plane.hpp>
+#include <lift.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+using cells = jge::soa_plane<std::uint16_t, float, bool>;
+
+static_assert(std::regular<cells>);
+static_assert(std::movable<jge::soa_plane<std::unique_ptr<int>, int>>);
+static_assert(!std::copyable<jge::soa_plane<std::unique_ptr<int>, int>>);
+static_assert(std::same_as<cells::field_type<1>, float>);
+static_assert(std::same_as<
+              decltype(to1d<1>(std::declval<cells&>())), std::span<float>>);
+static_assert(std::same_as<
+              decltype(to1d<2>(std::declval<const cells&>())),
+              std::span<const bool>>);
+
+constexpr void test()
+{
+    {
+        const cells p;
+        assert(p.size() == 0_w + 0_h);
+        assert(to1d<0>(p).empty());
+    }
+    {
+        cells p{2_w + 3_h, jge::value_initialize};
+        assert(p.size() == 2_w + 3_h);
+        assert(std::ranges::all_of(to1d<1>(p), lift::equal(0.0F)));
+
+        auto [id, light, flag]{p[1_x + 2_y]};
+        id    = 7;
+        light = 0.5F;
+        flag  = true;
+        assert(p[1_x + 2_y] == std::tuple(7, 0.5F, true));
+        assert(to1d<0>(p).back() == 7);
+        assert(to1d<1>(p).back() == 0.5F);
+        assert(to1d<2>(p).back());
+
+        p[0_x + 0_y] = cells::value_type{1, 2.0F, false};
+        assert(std::get<0>(std::as_const(p)[0_x + 0_y]) == 1);
+        std::ranges::fill(to1d<1>(p), 1.0F);
+        assert(std::get<1>(p[0_x + 1_y]) == 1.0F);
+        assert(std::get<0>(p[0_x + 1_y]) == 0);
+
+        const cells copy{p};
+        assert(copy == p);
+        std::get<2>(p[0_x + 0_y]) = true;
+        assert(copy != p);
+    }
+    {
+        const cells p{
+            {{1, 1.0F, true}, {2, 2.0F, false}},
+            {{3, 3.0F, true}, {4, 4.0F, false}}};
+        assert(p.size() == 2_w + 2_h);
+        assert(std::ranges::equal(to1d<0>(p), std::array{1, 2, 3, 4}));
+        assert(p[1_x + 1_y] == std::tuple(4, 4.0F, false));
+    }
+    {
+        const jge::soa_plane<int, char> p{
+            jge::plane<int>{{0, 1}, {2, 3}},
+            jge::plane<char>{{'a', 'b'}, {'c', 'd'}}};
+        assert(p[1_x + 0_y] == std::tuple(1, 'b'));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/static_plane.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+template <class T>
+using static_plane_1x1 = jge::static_plane<T, 1, 1>;
+
+static_assert(+std::regular</*  */ jge::static_plane<int, 2, 3>>);
+static_assert(+std::movable</*  */ static_plane_1x1<std::unique_ptr<int>>>);
+static_assert(!std::copyable</* */ static_plane_1x1<std::unique_ptr<int>>>);
+static_assert(std::is_trivially_copyable_v<jge::static_plane<int, 2, 3>>);
+static_assert(sizeof(jge::static_plane<int, 2, 3>) == sizeof(int[6]));
+static_assert(jge::static_plane<int, 2, 3>::size() == 2_w + 3_h);
+static_assert(jge::static_plane<int, 0, 0>::size() == 0_w + 0_h);
+static_assert(std::same_as<
+              std::span<int, 6>,
+              decltype(to1d(std::declval<jge::static_plane<int, 2, 3>&>()))>);
+
+// An element whose default constructor may throw.
+struct throwing_default
+{
+    throwing_default() noexcept(false)
+    {
+    }
+
+    bool operator==(const throwing_default&) const = default;
+};
+
+template <class T>
+using il2d = std::initializer_list<std::initializer_list<T>>;
+static_assert(std::is_nothrow_constructible_v<
+              jge::static_plane<int, 1, 1>, il2d<int>>);
+static_assert(!std::is_nothrow_constructible_v<
+              jge::static_plane<throwing_default, 1, 1>,
+              il2d<throwing_default>>);
+
+constexpr void test()
+{
+    {
+        const jge::static_plane<int, 2, 2> p;
+        assert(std::ranges::equal(std::array{0, 0, 0, 0}, to1d(p)));
+        assert((p == jge::static_plane<int, 2, 2>(jge::value_initialize)));
+    }
+    {
+        jge::static_plane<int, 3, 2> p{{0, 1, 2}, {3, 4, 5}};
+        const auto& cp{p};
+        assert(std::ranges::equal(std::array{0, 1, 2, 3, 4, 5}, to1d(cp)));
+        assert(cp[0_x + 0_y] == 0);
+        assert(cp[2_x + 0_y] == 2);
+        assert(cp[0_x + 1_y] == 3);
+        assert(cp[2_x + 1_y] == 5);
+        assert(&p[1_x + 1_y] == &cp[1_x + 1_y]);
+        assert((p[1_x + 1_y] = 6) == 6);
+        assert(p != (jge::static_plane<int, 3, 2>{{0, 1, 2}, {3, 4, 5}}));
+    }
+    {
+        jge::static_plane<int, 1, 1> p{jge::default_initialize};
+        p[0_x + 0_y] = 1;
+        assert(p[0_x + 0_y] == 1);
+    }
+    {
+        const jge::plane p{{0, 1}, {2, 3}, {4, 5}};
+        const jge::static_plane<int, 2, 3> sp{p};
+        assert(std::ranges::equal(to1d(p), to1d(sp)));
+        assert(jge::plane<int>(sp) == p);
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,203 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/stencil.hpp>
+#include <jge/thread_pool.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+jge::point2d<std::size_t> at(const std::size_t x, const std::size_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+jge::size2d<std::size_t> size(const std::size_t w, const std::size_t h)
+{
+    return jge::width{w} + jge::height{h};
+}
+
+jge::plane<int> numbered(const jge::size2d<std::size_t> sz)
+{
+    jge::plane<int> p{sz, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(sz); ++i)
+        to1d(p)[i] = static_cast<int>(i * 7 % 23) - 11;
+    return p;
+}
+
+static_assert(jge::border::clamp::index(-2, 4) == 0);
+static_assert(jge::border::clamp::index(5, 4) == 3);
+static_assert(jge::border::wrap::index(-2, 4) == 2);
+static_assert(jge::border::wrap::index(5, 4) == 1);
+static_assert(jge::border::wrap::index(-9, 4) == 3);
+static_assert(jge::border::mirror::index(-1, 4) == 0);
+static_assert(jge::border::mirror::index(-2, 4) == 1);
+static_assert(jge::border::mirror::index(4, 4) == 3);
+static_assert(jge::border::mirror::index(5, 4) == 2);
+static_assert(jge::border::mirror::index(8, 4) == 0);
+static_assert(jge::border::mirror::index(-3, 1) == 0);
+
+// The element of `p` at (`x`, `y`), as the hand-written loops do.
+template <class Border>
+int sample(
+    const jge::plane<int>& p, const Border& b, const std::ptrdiff_t x,
+    const std::ptrdiff_t y)
+{
+    const jge::point2d<std::ptrdiff_t> pt{
+        jge::abscissa{x} + jge::ordinate{y}};
+    const jge::size2d<std::ptrdiff_t> sz = p.size();
+    if (contains(sz, pt))
+        return p[at(std::size_t(x), std::size_t(y))];
+    if constexpr (jge::detail::is_constant_border_v<Border>)
+        return b.value;
+    else
+        return p
+            [at(Border::index(x, p.size().w()),
+                Border::index(y, p.size().h()))];
+}
+
+template <class Border>
+jge::plane<int> convolved(
+    const jge::plane<int>& p, const jge::plane<int>& kernel, const Border& b)
+{
+    jge::plane<int> res{p.size(), jge::value_initialize};
+    const auto ax{std::ptrdiff_t(kernel.size().w() / 2)};
+    const auto ay{std::ptrdiff_t(kernel.size().h() / 2)};
+    for (std::size_t y{0}; y != p.size().h(); ++y)
+        for (std::size_t x{0}; x != p.size().w(); ++x)
+            for (std::size_t ky{0}; ky != kernel.size().h(); ++ky)
+                for (std::size_t kx{0}; kx != kernel.size().w(); ++kx)
+                    res[at(x, y)] +=
+                        kernel[at(kx, ky)] *
+                        sample(
+                            p, b, std::ptrdiff_t(x + kx) - ax,
+                            std::ptrdiff_t(y + ky) - ay);
+    return res;
+}
+
+void test_small()
+{
+    const jge::plane<int> p{{1, 2, 3}, {4, 5, 6}};
+    const jge::plane<int> box{{1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
+    jge::plane<int> res{3_w + 2_h, jge::value_initialize};
+
+    jge::convolve(p, res, box);
+    assert((res == jge::plane<int>{{21, 27, 33}, {30, 36, 42}}));
+    jge::convolve(p, res, box, jge::border::constant{0});
+    assert((res == jge::plane<int>{{12, 21, 16}, {12, 21, 16}}));
+    jge::convolve(p, res, box, jge::border::wrap{});
+    assert((res == jge::plane<int>{{36, 36, 36}, {27, 27, 27}}));
+
+    jge::convolve_separable(
+        p, res, std::array{1, 1, 1}, std::array{1, 1, 1},
+        jge::border::constant{0});
+    assert((res == jge::plane<int>{{12, 21, 16}, {12, 21, 16}}));
+
+    // Count of the live neighbors, like for the Game of Life.
+    const jge::plane<int> cells{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 1}};
+    jge::plane<int> counts{4_w + 3_h, jge::value_initialize};
+    jge::stencil(
+        cells, counts, 1,
+        [](const auto& n) {
+            int count{-n(0, 0)};
+            for (const int dy : {-1, 0, 1})
+                for (const int dx : {-1, 0, 1})
+                    count += n(dx, dy);
+            return count;
+        },
+        jge::border::wrap{});
+    assert((counts == jge::plane<int>{
+                          {2, 2, 2, 2}, {3, 1, 2, 2}, {3, 2, 2, 1}}));
+
+    // Into a subplane, with points relative to it.
+    jge::plane<int> big{5_w + 4_h, jge::value_initialize};
+    jge::stencil(
+        p, jge::plane_view{big, {1_x + 1_y, 3_w + 2_h}}, 0,
+        [](const auto& n) { return n(0, 0) * 10 + int(n.point().x()); });
+    assert((big == jge::plane<int>{
+                       {0, 0, 0, 0, 0},
+                       {0, 10, 21, 32, 0},
+                       {0, 40, 51, 62, 0},
+                       {0, 0, 0, 0, 0}}));
+}
+
+template <class Border>
+void test_against_definitions(const Border& b, jge::thread_pool& pool)
+{
+    const jge::plane<int> kernels[]{
+        {{2}},
+        {{1, 2, 1}, {2, 4, 2}, {1, 2, 1}},
+        {{1, -2, 3, 0, 5}, {0, 1, 1, 1, 0}, {4, 0, -1, 2, 1}},
+        {{1, 2}, {3, 4}},
+        {{1}, {2}, {3}, {4}, {5}, {6}, {7}},
+    };
+    for (const auto sz :
+         {size(1, 1), size(2, 5), size(7, 3), size(40, 33), size(130, 301)})
+    {
+        const jge::plane<int> p{numbered(sz)};
+        jge::plane<int> res{sz, jge::value_initialize};
+        for (const jge::plane<int>& k : kernels)
+        {
+            jge::convolve(p, res, k, b, pool);
+            assert(res == convolved(p, k, b));
+        }
+
+        const std::array kx{1, -2, 4, 3, 1};
+        const std::array ky{2, 1, -1};
+        jge::plane<int> outer{5_w + 3_h, jge::value_initialize};
+        for (std::size_t y{0}; y != 3; ++y)
+            for (std::size_t x{0}; x != 5; ++x)
+                outer[at(x, y)] = kx[x] * ky[y];
+        jge::convolve_separable(p, res, kx, ky, b, pool);
+        assert(res == convolved(p, outer, b));
+
+        jge::stencil(
+            p, res, 2,
+            [](const auto& n) { return n(-2, 1) - n(2, -2) * n(0, 0); }, b,
+            pool);
+        for (std::size_t y{0}; y != sz.h(); ++y)
+            for (std::size_t x{0}; x != sz.w(); ++x)
+            {
+                const auto s{[&](const std::ptrdiff_t dx,
+                                 const std::ptrdiff_t dy) {
+                    return sample(
+                        p, b, std::ptrdiff_t(x) + dx, std::ptrdiff_t(y) + dy);
+                }};
+                assert(res[at(x, y)] == s(-2, 1) - s(2, -2) * s(0, 0));
+            }
+    }
+}
+
+int main()
+{
+    test_small();
+    for (const std::size_t threads : {1, 3})
+    {
+        jge::thread_pool pool{threads};
+        test_against_definitions(jge::border::clamp{}, pool);
+        test_against_definitions(jge::border::wrap{}, pool);
+        test_against_definitions(jge::border::mirror{}, pool);
+        test_against_definitions(jge::border::constant{-3}, pool);
+    }
+}
@@ -0,0 +1,63 @@
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <jge/thread_pool.hpp>
+
+void test_run(jge::thread_pool& pool)
+{
+    for (const std::size_t n : {0, 1, 2, 3, 100, 10'000})
+    {
+        std::vector<std::atomic<int>> calls(n);
+        pool.run(n, [&](const std::size_t i) { ++calls[i]; });
+        for (const std::atomic<int>& c : calls)
+            assert(c == 1);
+    }
+}
+
+void test_exception(jge::thread_pool& pool)
+{
+    std::atomic<std::size_t> calls{0};
+    bool thrown{false};
+    try
+    {
+        pool.run(1'000, [&](const std::size_t i) {
+            ++calls;
+            if (i == 10)
+                throw std::runtime_error{"task"};
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(calls >= 1);
+
+    // The pool is still usable.
+    test_run(pool);
+}
+
+void test_nested(jge::thread_pool& pool)
+{
+    std::atomic<std::size_t> calls{0};
+    pool.run(8, [&](std::size_t) {
+        pool.run(8, [&](std::size_t) { ++calls; });
+    });
+    assert(calls == 64);
+}
+
+int main()
+{
+    for (const std::size_t threads : {1, 2, 4})
+    {
+        jge::thread_pool pool{threads};
+        assert(pool.size() == threads);
+        test_run(pool);
+        test_exception(pool);
+        test_nested(pool);
+    }
+    assert(jge::default_thread_pool().size() >= 1);
+    test_run(jge::default_thread_pool());
+}
@@ -0,0 +1,174 @@
+#include <cassert>
+#include <cstddef>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/transpose.hpp>
+
+consteval auto operator""_w(unsigned long long w) noexcept
+{
+    return jge::width{w};
+}
+
+consteval auto operator""_h(unsigned long long h) noexcept
+{
+    return jge::height{h};
+}
+
+consteval auto operator""_x(unsigned long long x) noexcept
+{
+    return jge::abscissa{x};
+}
+
+consteval auto operator""_y(unsigned long long y) noexcept
+{
+    return jge::ordinate{y};
+}
+
+constexpr jge::point2d<std::size_t> at(const std::size_t x, const std::size_t y)
+{
+    return jge::abscissa{x} + jge::ordinate{y};
+}
+
+constexpr jge::plane<int> numbered(const jge::size2d<std::size_t> sz)
+{
+    jge::plane<int> p{sz, jge::value_initialize};
+    for (std::size_t i{0}; i != to1d(sz); ++i)
+        to1d(p)[i] = static_cast<int>(i);
+    return p;
+}
+
+constexpr jge::size2d<std::size_t> transposed(const jge::size2d<std::size_t> sz)
+{
+    return jge::width{sz.h()} + jge::height{sz.w()};
+}
+
+constexpr void test()
+{
+    const jge::plane<int> p{{0, 1, 2}, {3, 4, 5}};
+
+    jge::plane<int> t{2_w + 3_h, jge::value_initialize};
+    jge::transpose(p, t);
+    assert((t == jge::plane<int>{{0, 3}, {1, 4}, {2, 5}}));
+    jge::rotate90(p, t);
+    assert((t == jge::plane<int>{{3, 0}, {4, 1}, {5, 2}}));
+    jge::rotate270(p, t);
+    assert((t == jge::plane<int>{{2, 5}, {1, 4}, {0, 3}}));
+
+    jge::plane<int> s{3_w + 2_h, jge::value_initialize};
+    jge::rotate180(p, s);
+    assert((s == jge::plane<int>{{5, 4, 3}, {2, 1, 0}}));
+    jge::flip_x(p, s);
+    assert((s == jge::plane<int>{{2, 1, 0}, {5, 4, 3}}));
+    jge::flip_y(p, s);
+    assert((s == jge::plane<int>{{3, 4, 5}, {0, 1, 2}}));
+
+    s = p;
+    jge::flip_x(s);
+    assert((s == jge::plane<int>{{2, 1, 0}, {5, 4, 3}}));
+    s = p;
+    jge::flip_y(s);
+    assert((s == jge::plane<int>{{3, 4, 5}, {0, 1, 2}}));
+    s = p;
+    jge::rotate180(s);
+    assert((s == jge::plane<int>{{5, 4, 3}, {2, 1, 0}}));
+
+    jge::plane<int> q{{0, 1}, {2, 3}};
+    jge::transpose(q);
+    assert((q == jge::plane<int>{{0, 2}, {1, 3}}));
+    jge::rotate90(q);
+    assert((q == jge::plane<int>{{1, 0}, {3, 2}}));
+    jge::rotate270(q);
+    assert((q == jge::plane<int>{{0, 2}, {1, 3}}));
+
+    // Into a subplane.
+    jge::plane<int> big{4_w + 4_h, jge::value_initialize};
+    jge::transpose(p, jge::plane_view{big, {1_x + 1_y, 2_w + 3_h}});
+    assert((big == jge::plane<int>{
+                       {0, 0, 0, 0},
+                       {0, 0, 3, 0},
+                       {0, 1, 4, 0},
+                       {0, 2, 5, 0}}));
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+// Sizes that are not multiples of the block, and strided views.
+void test_against_definitions()
+{
+    for (const std::size_t w : {1, 7, 33, 70})
+        for (const std::size_t h : {1, 5, 32, 65})
+        {
+            const auto sz{jge::width{w} + jge::height{h}};
+            const jge::plane<int> p{numbered(sz)};
+            jge::plane<int> big{
+                jge::width{h + 3} + jge::height{w + 2}, jge::value_initialize};
+            const jge::plane_view to{big, {at(2, 1), transposed(sz)}};
+            jge::plane<int> same{sz, jge::value_initialize};
+
+            jge::transpose(p, to);
+            for (std::size_t y{0}; y != h; ++y)
+                for (std::size_t x{0}; x != w; ++x)
+                    assert(to[at(y, x)] == p[at(x, y)]);
+            jge::rotate90(p, to);
+            for (std::size_t y{0}; y != h; ++y)
+                for (std::size_t x{0}; x != w; ++x)
+                    assert(to[at(h - 1 - y, x)] == p[at(x, y)]);
+            jge::rotate270(p, to);
+            for (std::size_t y{0}; y != h; ++y)
+                for (std::size_t x{0}; x != w; ++x)
+                    assert(to[at(y, w - 1 - x)] == p[at(x, y)]);
+            jge::rotate180(p, same);
+            for (std::size_t y{0}; y != h; ++y)
+                for (std::size_t x{0}; x != w; ++x)
+                    assert(same[at(w - 1 - x, h - 1 - y)] == p[at(x, y)]);
+
+            if (w == h)
+            {
+                jge::plane<int> r{p};
+                jge::transpose(r);
+                jge::plane<int> expected{sz, jge::value_initialize};
+                jge::transpose(p, expected);
+                assert(r == expected);
+                r = p;
+                jge::rotate90(r);
+                jge::rotate90(p, expected);
+                assert(r == expected);
+                r = p;
+                jge::rotate270(r);
+                jge::rotate270(p, expected);
+                assert(r == expected);
+            }
+        }
+
+    // In place, on a square subplane of a larger plane.
+    jge::plane<int> p{numbered(
+        jge::width{std::size_t{40}} + jge::height{std::size_t{40}})};
+    const jge::plane<int> original{p};
+    const jge::plane_view v{p, {at(3, 2), 35_w + 35_h}};
+    jge::transpose(v);
+    for (std::size_t y{0}; y != 40; ++y)
+        for (std::size_t x{0}; x != 40; ++x)
+        {
+            const bool inside{3 <= x && x < 38 && 2 <= y && y < 37};
+            assert(
+                p[at(x, y)] ==
+                (inside ? original[at(y - 2 + 3, x - 3 + 2)]
+                        : original[at(x, y)]));
+        }
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+    test_against_definitions();
+}
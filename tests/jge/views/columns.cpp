@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/views/columns.hpp>
+
+using columns_t =
+    decltype(jge::views::columns(std::declval<jge::plane<int>&>()));
+using column_t = std::ranges::range_value_t<columns_t>;
+
+static_assert(std::ranges::view<columns_t>);
+static_assert(std::ranges::random_access_range<columns_t>);
+static_assert(std::ranges::sized_range<columns_t>);
+static_assert(std::ranges::view<column_t>);
+static_assert(std::ranges::random_access_range<column_t>);
+static_assert(std::ranges::sized_range<column_t>);
+static_assert(std::same_as<std::ranges::range_reference_t<column_t>, int&>);
+static_assert(std::same_as<
+              std::ranges::range_reference_t<
+                  std::ranges::range_value_t<decltype(jge::views::columns(
+                      std::declval<const jge::plane<int>&>()))>>,
+              const int&>);
+
+constexpr void test()
+{
+    using namespace jge;
+
+    {
+        plane<int> p{{0, 1, 2}, {3, 4, 5}};
+        const auto columns{views::columns(p)};
+        assert(std::ranges::size(columns) == 3);
+        assert(std::ranges::size(columns[0]) == 2);
+        assert(std::ranges::equal(columns[0], std::array{0, 3}));
+        assert(std::ranges::equal(columns[2], std::array{2, 5}));
+        std::ranges::fill(columns[1], -1);
+        assert((p == plane<int>{{0, -1, 2}, {3, -1, 5}}));
+    }
+
+    {
+        const plane<int> p{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        const auto columns{views::columns(plane_view{
+            p, {abscissa{std::size_t{1}} + ordinate{std::size_t{1}},
+                width{std::size_t{2}} + height{std::size_t{2}}}})};
+        assert(std::ranges::size(columns) == 2);
+        assert(std::ranges::equal(columns[0], std::array{4, 7}));
+        assert(std::ranges::equal(columns[1], std::array{5, 8}));
+        assert(columns[1][1] == 8);
+    }
+
+    {
+        const plane<int> p;
+        assert(std::ranges::empty(views::columns(p)));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
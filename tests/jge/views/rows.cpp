@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <jge/cartesian.hpp>
+#include <jge/plane.hpp>
+#include <jge/plane_view.hpp>
+#include <jge/views/rows.hpp>
+
+using rows_t = decltype(jge::views::rows(std::declval<jge::plane<int>&>()));
+
+static_assert(std::ranges::view<rows_t>);
+static_assert(std::ranges::random_access_range<rows_t>);
+static_assert(std::ranges::sized_range<rows_t>);
+static_assert(
+    std::same_as<std::ranges::range_reference_t<rows_t>, std::span<int>>);
+static_assert(std::same_as<
+              std::ranges::range_reference_t<decltype(jge::views::rows(
+                  std::declval<const jge::plane<int>&>()))>,
+              std::span<const int>>);
+static_assert(!std::invocable<decltype(jge::views::rows), jge::plane<int>>);
+static_assert(
+    std::invocable<decltype(jge::views::rows), jge::plane_view<int>>);
+
+constexpr void test()
+{
+    using namespace jge;
+
+    {
+        plane<int> p{{0, 1, 2}, {3, 4, 5}};
+        const auto rows{views::rows(p)};
+        assert(std::ranges::size(rows) == 2);
+        assert(std::ranges::equal(rows[0], std::array{0, 1, 2}));
+        assert(std::ranges::equal(rows[1], std::array{3, 4, 5}));
+        for (const std::span<int> row : rows)
+            for (int& e : row)
+                e *= 2;
+        assert((p == plane<int>{{0, 2, 4}, {6, 8, 10}}));
+    }
+
+    {
+        const plane<int> p{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        const auto rows{views::rows(plane_view{
+            p, {abscissa{std::size_t{1}} + ordinate{std::size_t{1}},
+                width{std::size_t{2}} + height{std::size_t{2}}}})};
+        assert(std::ranges::size(rows) == 2);
+        assert(std::ranges::equal(rows[0], std::array{4, 5}));
+        assert(std::ranges::equal(rows.back(), std::array{7, 8}));
+    }
+
+    {
+        const plane<int> p;
+        assert(std::ranges::empty(views::rows(p)));
+    }
+}
+
+consteval auto const_invoke(auto f)
+{
+    return f();
+}
+
+auto run_invoke(auto f)
+{
+    return f();
+}
+
+int main()
+{
+    const_invoke(test);
+    run_invoke(test);
+}
@@ -0,0 +1,6 @@
+CPMFindPackage(
+    NAME benchmark
+    GITHUB_REPOSITORY google/benchmark
+    GIT_TAG master
+    GIT_SHALLOW True
+    OPTIONS "BENCHMARK_ENABLE_TESTING OFF")
@@ -31,6 +31,18 @@ if(range-v3_ADDED)
                                INTERFACE ${range-v3_SOURCE_DIR}/include)
 endif()
 
+CPMFindPackage(
+    NAME mdspan
+    GITHUB_REPOSITORY kokkos/mdspan
+    GIT_TAG stable
+    GIT_SHALLOW True
+    DOWNLOAD_ONLY True)
+if(mdspan_ADDED)
+    add_library(std::mdspan INTERFACE IMPORTED GLOBAL)
+    target_include_directories(std::mdspan
+                               INTERFACE ${mdspan_SOURCE_DIR}/include)
+endif()
+
 CPMFindPackage(
     NAME mp-units
     GITHUB_REPOSITORY mpusz/units
@@ -47,3 +59,5 @@ CPMFindPackage(
     GIT_TAG master
     GIT_SHALLOW True)
 list(APPEND CMAKE_MODULE_PATH ${jegp_cmake_modules_SOURCE_DIR})
+
+find_package(Threads REQUIRED)
@@ -1,3 +1,4 @@
 option(JGE_TEST "Test the library.")
+option(JGE_BENCHMARK "Benchmark the library.")
 set(JGE_EXAMPLES CACHE STRING "List of examples to build.")
 set_property(CACHE JGE_EXAMPLES PROPERTY STRINGS "LPC")